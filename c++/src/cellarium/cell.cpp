@@ -96,3 +96,31 @@ Cell::~Cell() noexcept {};
 bool Cell::operator==(const Cell &cell) const noexcept { return _index == cell._index; }
 
 bool Cell::operator!=(const Cell &cell) const noexcept { return _index != cell._index; }
+
+const std::vector<int> &Cell::getGenome() const noexcept { return _genome; }
+
+int Cell::getCounter() const noexcept { return _counter; }
+
+int Cell::getEnergy() const noexcept { return _energy; }
+
+int Cell::getMinerals() const noexcept { return _minerals; }
+
+int Cell::getDirection() const noexcept { return _direction; }
+
+int Cell::getIndex() const noexcept { return _index; }
+
+int Cell::getAge() const noexcept { return _age; }
+
+int Cell::getColorR() const noexcept { return _colorR; }
+
+int Cell::getColorG() const noexcept { return _colorG; }
+
+int Cell::getColorB() const noexcept { return _colorB; }
+
+int Cell::getEnergyShareBalance() const noexcept { return _energyShareBalance; }
+
+float Cell::getLastEnergyShare() const noexcept { return _lastEnergyShare; }
+
+bool Cell::isAlive() const noexcept { return _isAlive; }
+
+bool Cell::isPinned() const noexcept { return _isPinned; }
@@ -12,7 +12,7 @@
 
 namespace cellarium {
 
-// Class for storing cell properties
+// Class for storing a copy of cell properties taken from CellController (for viewing)
 class Cell {
  private:
   std::vector<int> _genome{};
@@ -49,10 +49,23 @@ class Cell {
   bool operator==(const Cell &cell) const noexcept;
   bool operator!=(const Cell &cell) const noexcept;
 
-  friend class CellController;
+  // Getters
+  const std::vector<int> &getGenome() const noexcept;
+  int                     getCounter() const noexcept;
+  int                     getEnergy() const noexcept;
+  int                     getMinerals() const noexcept;
+  int                     getDirection() const noexcept;
+  int                     getIndex() const noexcept;
+  int                     getAge() const noexcept;
+  int                     getColorR() const noexcept;
+  int                     getColorG() const noexcept;
+  int                     getColorB() const noexcept;
+  int                     getEnergyShareBalance() const noexcept;
+  float                   getLastEnergyShare() const noexcept;
+  bool                    isAlive() const noexcept;
+  bool                    isPinned() const noexcept;
 
-  // Friend function for viewing struct properties
-  friend void processCellOverview(Cell &cell, bool selectedCellExists);
+  friend class CellController;
 };
 
 }
@@ -10,9 +10,34 @@
 // STD
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
 #include <utility>
 
+// "genome_comparison" internal header
+#include "./genome_comparison.hpp"
+
+// Cycle counter for profiler (steady clock is used where there is no timestamp counter)
+#ifdef CELLARIUM_PROFILING
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CELLARIUM_PROFILING_RDTSC
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#include <chrono>
+#endif
+#endif
+
 // Using header file namespace
 using namespace cellarium;
 
@@ -37,16 +62,130 @@ static constexpr float kBuddedCellParentColorMultiplier = 2.0f;
 // Mathematical constant
 static constexpr float kTwoPi = 6.28318530f;
 
+// Age after which color of cell does not change in age cell rendering mode
+static constexpr float kMaxRenderedAge = 1000.0f;
+
+// Minimal tile width and height (cells in tiles of the same color are at least 3 cells apart
+// so ones computed in parallel can not reach the same cell through kDirectionOffsets)
+static constexpr int kMinTileSize = 2;
+// Count of tile colors (tile column parity and tile row parity)
+static constexpr int kTileColorCount = 4;
+
+// Bits of grid slot change flags (changed properties and genome since slots were cleared
+// and changed appearance since slots were rendered to texture)
+static constexpr std::uint8_t kSlotChangedProperties = 1u << 0;
+static constexpr std::uint8_t kSlotChangedGenome     = 1u << 1;
+static constexpr std::uint8_t kSlotChangedRendering  = 1u << 2;
+// Mask of grid slot change flags saved to delta snapshots
+static constexpr std::uint8_t kSlotChangedSnapshotMask =
+    kSlotChangedProperties | kSlotChangedGenome;
+
+// Offset basis and prime of state hash (FNV-1a over 64-bit words with folding of high bits)
+static constexpr std::uint64_t kStateHashOffsetBasis = 14695981039346656037ull;
+static constexpr std::uint64_t kStateHashPrime       = 1099511628211ull;
+// Multiplier of cell word positions giving keys of cell words
+static constexpr std::uint64_t kStateHashKeyMultiplier = 0x9e3779b97f4a7c15ull;
+
+// Bits of enabling flags bitset act() is specialized for
+// (instruction flags, rule flags checked in act() itself and genome interpreter)
+static constexpr std::uint32_t kActFlagTurn                                 = 1u << 0;
+static constexpr std::uint32_t kActFlagMove                                 = 1u << 1;
+static constexpr std::uint32_t kActFlagGetEnergyFromPhotosynthesis          = 1u << 2;
+static constexpr std::uint32_t kActFlagGetEnergyFromMinerals                = 1u << 3;
+static constexpr std::uint32_t kActFlagGetEnergyFromFood                    = 1u << 4;
+static constexpr std::uint32_t kActFlagBud                                  = 1u << 5;
+static constexpr std::uint32_t kActFlagMutateRandomGene                     = 1u << 6;
+static constexpr std::uint32_t kActFlagShareEnergy                          = 1u << 7;
+static constexpr std::uint32_t kActFlagTouch                                = 1u << 8;
+static constexpr std::uint32_t kActFlagDetermineEnergyLevel                 = 1u << 9;
+static constexpr std::uint32_t kActFlagDetermineDepth                       = 1u << 10;
+static constexpr std::uint32_t kActFlagDetermineBurstOfPhotosynthesisEnergy = 1u << 11;
+static constexpr std::uint32_t kActFlagDetermineBurstOfMinerals             = 1u << 12;
+static constexpr std::uint32_t kActFlagDetermineBurstOfMineralEnergy        = 1u << 13;
+static constexpr std::uint32_t kActFlagZeroEnergyOrganic                    = 1u << 14;
+static constexpr std::uint32_t kActFlagForcedBuddingOnMaximalEnergyLevel    = 1u << 15;
+static constexpr std::uint32_t kActFlagThreadedInterpreter                  = 1u << 16;
+// All instruction flags
+static constexpr std::uint32_t kActFlagsAllInstructions = (1u << 14) - 1u;
+// Instruction and rule flags are read from fields at runtime (genome interpreter is still fixed)
+static constexpr std::uint32_t kActFlagsDynamic = 1u << 17;
+
+// Returns whether act() flag is enabled (known at compile time unless flags bitset is dynamic)
+template <std::uint32_t kActFlags>
+static constexpr bool isActFlagEnabled(std::uint32_t actFlag, bool enableFlag) {
+  return (kActFlags & kActFlagsDynamic) != 0 ? enableFlag : (kActFlags & actFlag) != 0;
+}
+
+#ifdef CELLARIUM_PROFILING
+// Period of handler calls whose cycles are sampled
+static constexpr long kHandlerSamplePeriod = 16;
+
+// Returns value of cycle counter
+static inline std::uint64_t readCycleCounter() noexcept {
+#ifdef CELLARIUM_PROFILING_RDTSC
+  return __rdtsc();
+#else
+  return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                        std::chrono::steady_clock::now().time_since_epoch())
+                                        .count());
+#endif
+}
+
+// Returns index of instruction in profile counters (unconditional jumps share the last one)
+static constexpr int getProfiledInstructionIndex(int instruction) noexcept {
+  return instruction >= 0 && instruction < kProfiledInstructionCount - 1
+             ? instruction
+             : kProfiledInstructionCount - 1;
+}
+
+// Class counting handler call in its scope and sampling cycles of each kHandlerSamplePeriod-th one
+class HandlerProfiler {
+ private:
+  CellController::Profile &_profile;
+  const int                _handler;
+  const bool               _isSampled;
+  const std::uint64_t      _startCycles;
+
+ public:
+  HandlerProfiler(CellController::Profile &profile, ProfiledHandlers handler) noexcept
+      : _profile{profile},
+        _handler{static_cast<int>(handler)},
+        _isSampled{profile.handlerCallCounts[_handler]++ % kHandlerSamplePeriod == 0},
+        _startCycles{_isSampled ? readCycleCounter() : 0} {}
+  HandlerProfiler(const HandlerProfiler &handlerProfiler) = delete;
+  HandlerProfiler &operator=(const HandlerProfiler &handlerProfiler) = delete;
+  ~HandlerProfiler() noexcept {
+    if (_isSampled) {
+      _profile.handlerSampleCycles[_handler] += readCycleCounter() - _startCycles;
+      ++_profile.handlerSampleCounts[_handler];
+    }
+  }
+};
+
+// Counting executed instruction, instruction reaching instructions per tick limit and handler call
+#define PROFILE_INSTRUCTION(context, instruction) \
+  ++(context).profile.instructionCounts[getProfiledInstructionIndex(instruction)]
+#define PROFILE_INSTRUCTION_LIMIT(context, instruction) \
+  ++(context).profile.instructionLimitCounts[getProfiledInstructionIndex(instruction)]
+#define PROFILE_HANDLER(context, handler) \
+  const HandlerProfiler handlerProfiler { (context).profile, handler }
+#else
+// Profiler is disabled so it costs nothing (context is still referenced for handlers not using it)
+#define PROFILE_INSTRUCTION(context, instruction)
+#define PROFILE_INSTRUCTION_LIMIT(context, instruction)
+#define PROFILE_HANDLER(context, handler) static_cast<void>(context)
+#endif
+
 // Linearly interpolates value from one range (in) into another (out)
 template <typename T1, typename T2, typename T3, typename T4, typename T5>
-float map(T1 value, T2 inMin, T3 inMax, T4 outMin, T5 outMax) {
+static float map(T1 value, T2 inMin, T3 inMax, T4 outMin, T5 outMax) {
   return static_cast<float>(outMin) + (static_cast<float>(outMax) - static_cast<float>(outMin)) *
                                           (static_cast<float>(value) - static_cast<float>(inMin)) /
                                           (static_cast<float>(inMax) - static_cast<float>(inMin));
 }
 // Linearly interpolates value from one range (in) into another (out) with clamping
 template <typename T1, typename T2, typename T3, typename T4, typename T5>
-float mapClamp(T1 value, T2 inMin, T3 inMax, T4 outMin, T5 outMax) {
+static float mapClamp(T1 value, T2 inMin, T3 inMax, T4 outMin, T5 outMax) {
   // If inMin is less or equal to inMax
   if (static_cast<float>(inMin) <= static_cast<float>(inMax)) {
     // If value is less or equal to inMin - returning outMin
@@ -76,6 +215,254 @@ float mapClamp(T1 value, T2 inMin, T3 inMax, T4 outMin, T5 outMax) {
                                           (static_cast<float>(inMax) - static_cast<float>(inMin));
 }
 
+// Returns whether unpacked genomes differ in no more than maxDifference genes
+static bool areGenomesAkin(const int *genome1, const int *genome2, int genomeSize,
+                           int maxDifference) noexcept {
+  int diff{};
+
+  for (int i = 0; i < genomeSize; ++i) {
+    if (genome1[i] != genome2[i]) {
+      ++diff;
+      if (diff > maxDifference) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+// Returns whether genes can be stored in packed (8-bit) form
+// (mutations draw genes in [0, genomeSize), first cell genes are as is)
+static bool canPackGenes(const CellController::Params &params) {
+  if (params.genomeSize > kMaxPackedGene + 1) {
+    return false;
+  }
+
+  for (int gene : params.firstCellGenome) {
+    if (gene < 0 || gene > kMaxPackedGene) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Returns snapshot with given section sizes and fills its header except checksums
+static std::vector<std::uint8_t> createSnapshot(
+    const std::array<char, 8>                                                 &magic,
+    const std::array<std::uint64_t, static_cast<int>(SnapshotSections::Size)> &sectionSizes,
+    SnapshotHeader                                                            &header) {
+  header               = SnapshotHeader{};
+  header.magic         = magic;
+  header.version       = kSnapshotVersion;
+  header.byteOrderMark = kSnapshotByteOrderMark;
+
+  // Placing aligned sections one after another
+  std::uint64_t offset = sizeof(SnapshotHeader);
+  for (int i = 0; i < static_cast<int>(SnapshotSections::Size); ++i) {
+    header.sections[i] = {offset, sectionSizes[i]};
+    offset = (offset + sectionSizes[i] + kSnapshotSectionAlignment - 1) /
+             kSnapshotSectionAlignment * kSnapshotSectionAlignment;
+  }
+  header.snapshotSize = offset;
+
+  return std::vector<std::uint8_t>(header.snapshotSize);
+}
+
+// Returns pointer to the beginning of snapshot section
+template <typename T>
+static T *getSnapshotSection(T *snapshot, const SnapshotHeader &header,
+                             SnapshotSections section) noexcept {
+  return snapshot + header.sections[static_cast<int>(section)].offset;
+}
+
+// Copies header with checksum of the rest of snapshot to the beginning of snapshot
+static void finishSnapshot(SnapshotHeader &header, std::vector<std::uint8_t> &snapshot) noexcept {
+  header.checksum = calculateSnapshotChecksum(snapshot.data() + sizeof(SnapshotHeader),
+                                              snapshot.size() - sizeof(SnapshotHeader));
+  std::memcpy(snapshot.data(), &header, sizeof(SnapshotHeader));
+}
+
+// Returns whether simulation parameters can be applied
+// (time periods must be positive, environment table sizes must not be negative)
+static bool areSnapshotParametersValid(const SnapshotParameters &parameters) noexcept {
+  return parameters.dayDurationInTicks >= 1 && parameters.seasonDurationInDays >= 1 &&
+         parameters.gammaFlashPeriodInDays >= 1 && parameters.maxPhotosynthesisDepth >= 0 &&
+         parameters.maxMinerals >= 0 && parameters.maxMineralHeight >= 0 &&
+         parameters.genomeInterpreter >= 0 &&
+         parameters.genomeInterpreter < static_cast<int>(GenomeInterpreters::Size);
+}
+
+// Reads and checks snapshot header, world record and pseudo-random numbers generator state
+static int readSnapshotHeader(const std::uint8_t *snapshot, size_t snapshotSize,
+                              const std::array<char, 8> &magic, SnapshotHeader &header,
+                              SnapshotWorld &world, std::mt19937 &mersenneTwisterEngine) {
+  // Reading and checking header
+  if (snapshot == nullptr || snapshotSize < sizeof(SnapshotHeader)) {
+    std::cout << "error: snapshot is truncated" << std::endl;
+    return -1;
+  }
+  std::memcpy(&header, snapshot, sizeof(SnapshotHeader));
+  if (header.magic != magic) {
+    std::cout << "error: data is not a cellarium "
+              << (magic == kSnapshotMagic ? "snapshot" : "delta snapshot") << std::endl;
+    return -1;
+  }
+  if (header.byteOrderMark != kSnapshotByteOrderMark) {
+    std::cout << "error: snapshot was saved on machine with other byte order" << std::endl;
+    return -1;
+  }
+  if (header.version != kSnapshotVersion) {
+    std::cout << "error: snapshot version " << header.version << " is not supported (expected "
+              << kSnapshotVersion << ")" << std::endl;
+    return -1;
+  }
+  if (header.snapshotSize < sizeof(SnapshotHeader) || header.snapshotSize > snapshotSize) {
+    std::cout << "error: snapshot is truncated" << std::endl;
+    return -1;
+  }
+  const size_t checkedSize = static_cast<size_t>(header.snapshotSize) - sizeof(SnapshotHeader);
+  if (header.checksum !=
+      calculateSnapshotChecksum(snapshot + sizeof(SnapshotHeader), checkedSize)) {
+    std::cout << "error: snapshot is corrupted (checksum mismatch)" << std::endl;
+    return -1;
+  }
+  for (const SnapshotSection &section : header.sections) {
+    if (section.offset > header.snapshotSize ||
+        section.size > header.snapshotSize - section.offset) {
+      std::cout << "error: snapshot section is out of snapshot bounds" << std::endl;
+      return -1;
+    }
+  }
+
+  // Reading and checking world record
+  if (header.sections[static_cast<int>(SnapshotSections::World)].size != sizeof(SnapshotWorld)) {
+    std::cout << "error: snapshot world section is corrupted" << std::endl;
+    return -1;
+  }
+  std::memcpy(&world, getSnapshotSection(snapshot, header, SnapshotSections::World),
+              sizeof(SnapshotWorld));
+  if (world.columns < 1 || world.rows < 1 ||
+      static_cast<std::int64_t>(world.columns) * world.rows > std::numeric_limits<int>::max() ||
+      world.genomeSize < 1 || !areSnapshotParametersValid(world.parameters) ||
+      world.cellCount < 0 || world.cellCount > world.columns * world.rows ||
+      (world.areGenesPacked != 0 && world.genomeSize > kMaxPackedGene + 1)) {
+    std::cout << "error: snapshot world section is corrupted" << std::endl;
+    return -1;
+  }
+
+  // Checking sizes of sections of fixed-size records
+  const std::array<std::uint64_t, static_cast<int>(SnapshotSections::Size)> recordSizes{
+      sizeof(SnapshotWorld),
+      1,
+      sizeof(SnapshotCell),
+      (world.areGenesPacked != 0 ? sizeof(std::uint8_t) : sizeof(std::int32_t)) *
+          world.genomeSize,
+      sizeof(std::int32_t),
+      sizeof(std::int32_t),
+  };
+  for (int i = 0; i < static_cast<int>(SnapshotSections::Size); ++i) {
+    if (header.sections[i].size % recordSizes[i] != 0) {
+      std::cout << "error: snapshot section is corrupted" << std::endl;
+      return -1;
+    }
+  }
+
+  // Reading pseudo-random numbers generator state
+  const SnapshotSection &randomEngineSection =
+      header.sections[static_cast<int>(SnapshotSections::RandomEngine)];
+  std::istringstream randomEngineStream{
+      std::string{reinterpret_cast<const char *>(snapshot + randomEngineSection.offset),
+                  static_cast<size_t>(randomEngineSection.size)}};
+  randomEngineStream >> mersenneTwisterEngine;
+  if (randomEngineStream.fail()) {
+    std::cout << "error: snapshot pseudo-random numbers generator state is corrupted"
+              << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+// Returns whether snapshot cell properties and genome can be loaded
+static bool isSnapshotCellValid(const SnapshotCell &cell, const std::uint8_t *genomeData,
+                                const SnapshotWorld &world) noexcept {
+  if (cell.index < 0 || cell.index >= world.columns * world.rows || cell.counter < 0 ||
+      cell.counter >= world.genomeSize || cell.direction < 0 ||
+      cell.direction >= kDirectionCount) {
+    return false;
+  }
+
+  for (int i = 0; genomeData != nullptr && i < world.genomeSize; ++i) {
+    std::int32_t gene{};
+    if (world.areGenesPacked != 0) {
+      gene = genomeData[i];
+    } else {
+      std::memcpy(&gene, genomeData + sizeof(std::int32_t) * i, sizeof(std::int32_t));
+    }
+    if (gene < 0 || gene >= world.genomeSize) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Copies snapshot genome to genome arena slot
+static void setSnapshotGenome(GenomeArena &genomeArena, int genomeSlot,
+                              const std::uint8_t *genomeData) noexcept {
+  for (int i = 0; i < genomeArena.getGenomeSize(); ++i) {
+    std::int32_t gene{};
+    if (genomeArena.isPacked()) {
+      gene = genomeData[i];
+    } else {
+      std::memcpy(&gene, genomeData + sizeof(std::int32_t) * i, sizeof(std::int32_t));
+    }
+    genomeArena.setGene(genomeSlot, i, gene);
+  }
+}
+
+// Combines state hash with 64-bit word
+static inline std::uint64_t combineStateHash(std::uint64_t stateHash,
+                                             std::uint64_t value) noexcept {
+  stateHash = (stateHash ^ value) * kStateHashPrime;
+  return stateHash ^ (stateHash >> 32u);
+}
+
+// Returns 64-bit word of two 32-bit values
+static inline std::uint64_t packStateWord(std::uint32_t low, std::uint32_t high) noexcept {
+  return static_cast<std::uint64_t>(high) << 32u | low;
+}
+
+// Returns hash of 64-bit word at given position of cell record as product of its halves offset
+// by position key (products are independent, so cell words are hashed without waiting for
+// each other and only cell hash sum is combined with state hash)
+static inline std::uint64_t hashCellWord(std::uint64_t word, std::uint64_t position) noexcept {
+  const std::uint64_t key = (position + 1u) * kStateHashKeyMultiplier;
+  return ((word & 0xffffffffu) + (key & 0xffffffffu)) * ((word >> 32u) + (key >> 32u));
+}
+
+CellController::CellStorage::CellStorage() noexcept {}
+
+CellController::CellStorage::CellStorage(int maxCellCount)
+    : genomeSlots(maxCellCount),
+      counters(maxCellCount),
+      energies(maxCellCount),
+      minerals(maxCellCount),
+      directions(maxCellCount),
+      ages(maxCellCount),
+      colorsR(maxCellCount),
+      colorsG(maxCellCount),
+      colorsB(maxCellCount),
+      energyShareBalances(maxCellCount),
+      lastEnergyShares(maxCellCount),
+      areAlive(maxCellCount),
+      arePinned(maxCellCount),
+      areOccupied(maxCellCount),
+      actStamps(maxCellCount),
+      changes(maxCellCount) {}
+
 CellController::CellController() : CellController{Params{}} {}
 
 CellController::CellController(const Params &params)
@@ -89,14 +476,15 @@ CellController::CellController(const Params &params)
       _minChildEnergy{params.minChildEnergy},
       _maxEnergy{params.maxEnergy},
       _maxBurstOfPhotosynthesisEnergy{params.maxBurstOfPhotosynthesisEnergy},
-      _maxPhotosynthesisDepth(
-          static_cast<int>(static_cast<float>(_rows) * params.maxPhotosynthesisDepthMultiplier)),
+      _maxPhotosynthesisDepth(std::max(
+          static_cast<int>(static_cast<float>(_rows) * params.maxPhotosynthesisDepthMultiplier),
+          0)),
       _summerDaytimeToWholeDayRatio{params.summerDaytimeToWholeDayRatio},
-      _maxMinerals{params.maxMinerals},
+      _maxMinerals{std::max(params.maxMinerals, 0)},
       _maxBurstOfMinerals{params.maxBurstOfMinerals},
       _energyPerMineral{params.energyPerMineral},
-      _maxMineralHeight(
-          static_cast<int>(static_cast<float>(_rows) * params.maxMineralHeightMultiplier)),
+      _maxMineralHeight(std::max(
+          static_cast<int>(static_cast<float>(_rows) * params.maxMineralHeightMultiplier), 0)),
       _maxBurstOfFoodEnergy{params.maxBurstOfFoodEnergy},
       _childBudMutationChance{params.childBudMutationChance},
       _parentBudMutationChance{params.parentBudMutationChance},
@@ -129,30 +517,43 @@ CellController::CellController(const Params &params)
       _enableSeasons{params.enableSeasons},
       _enableDaytimes{params.enableDaytimes},
       _enableMaximizingFoodEnergy{params.enableMaximizingFoodEnergy},
-      _enableDeadCellPinningOnSinking{params.enableDeadCellPinningOnSinking} {
-  // Allocating memory for vector of cell pointers
+      _enableDeadCellPinningOnSinking{params.enableDeadCellPinningOnSinking},
+      _genomeInterpreter{params.genomeInterpreter},
+      _threadCount{std::max(params.threadCount, 0)},
+      _tileWidth{std::max(params.tileWidth, kMinTileSize)},
+      _tileHeight{params.tileHeight > 0 ? std::max(params.tileHeight, kMinTileSize) : 0} {
+  // Allocating memory for index list, cell storage columns and genome arena
   const int maxCellCount{_columns * _rows};
-  for (int i = 0; i < maxCellCount; ++i) {
-    _cellPtrVector.push_back(std::unique_ptr<Cell>{});
-  }
-  _cellPtrVector.reserve(maxCellCount);
+  _cellIndexList = IndexList{maxCellCount};
+  _cells         = CellStorage{maxCellCount};
+  _genomeArena   = GenomeArena{_genomeSize, canPackGenes(params)};
+  _takenCellTextureData.resize(maxCellCount);
 
   // Creating the first cell genome
-  std::vector<int> firstCellGenome;
-  const size_t     paramsFirstCellGenomeSize = params.firstCellGenome.size();
-  const int        firstCellDefaultGenomInstruction =
+  const int firstCellGenomeSlot       = _genomeArena.allocate();
+  const int paramsFirstCellGenomeSize = static_cast<int>(params.firstCellGenome.size());
+  const int firstCellDefaultGenomInstruction =
       params.firstCellGenome[paramsFirstCellGenomeSize - 1];
-  firstCellGenome.assign(_genomeSize, firstCellDefaultGenomInstruction);
-  for (size_t i = 0; i < paramsFirstCellGenomeSize; ++i) {
-    firstCellGenome[i] = params.firstCellGenome[i];
+  for (int i = 0; i < _genomeSize; ++i) {
+    _genomeArena.setGene(firstCellGenomeSlot, i,
+                         i < paramsFirstCellGenomeSize ? params.firstCellGenome[i]
+                                                       : firstCellDefaultGenomInstruction);
+  }
+
+  // Adding the first cell
+  ActContext context{RandomStream{&_mersenneTwisterEngine}};
+  addCell(static_cast<int>(static_cast<float>(_columns) * params.firstCellIndexMultiplier),
+          firstCellGenomeSlot,
+          static_cast<int>(static_cast<float>(_minChildEnergy) * params.firstCellEnergyMultiplier),
+          params.firstCellDirection, context);
+
+  // Creating thread pool if cells are computed in parallel and there is space for two tiles
+  if (_threadCount > 0 && _columns >= kMinTileSize * 2) {
+    _threadPool = std::make_unique<ThreadPool>(_threadCount);
   }
 
-  // Constructing and adding the first cell
-  addCell(std::make_unique<Cell>(
-      firstCellGenome,
-      static_cast<int>(static_cast<float>(_minChildEnergy) * params.firstCellEnergyMultiplier),
-      params.firstCellDirection,
-      static_cast<int>(static_cast<float>(_columns) * params.firstCellIndexMultiplier)));
+  // Picking act() specialization for enabling flags
+  updateActFunction();
 }
 
 CellController::CellController(const CellController &cellController) noexcept
@@ -209,24 +610,23 @@ CellController::CellController(const CellController &cellController) noexcept
       _enableDaytimes{cellController._enableDaytimes},
       _enableMaximizingFoodEnergy{cellController._enableMaximizingFoodEnergy},
       _enableDeadCellPinningOnSinking{cellController._enableDeadCellPinningOnSinking},
+      _genomeInterpreter{cellController._genomeInterpreter},
+      _threadCount{cellController._threadCount},
+      _tileWidth{cellController._tileWidth},
+      _tileHeight{cellController._tileHeight},
+      _actFlags{cellController._actFlags},
+      _actFunction{cellController._actFunction},
       _cellIndexList{cellController._cellIndexList},
-      // Copying _cellPtrVector in body
+      _cells{cellController._cells},
+      _takenCellTextureData{cellController._takenCellTextureData},
+      _genomeArena{cellController._genomeArena},
+      _threadPool{cellController._threadPool != nullptr
+                      ? std::make_unique<ThreadPool>(cellController._threadCount)
+                      : nullptr},
+      _actStamp{cellController._actStamp},
+      _environmentTables{cellController._environmentTables},
       _ticksNumber{cellController._ticksNumber},
-      _yearsNumber{cellController._yearsNumber} {
-  // Allocating memory for vector of cell pointers
-  const int maxCellCount{_columns * _rows};
-  for (int i = 0; i < maxCellCount; ++i) {
-    _cellPtrVector.push_back(std::unique_ptr<Cell>{});
-  }
-  _cellPtrVector.reserve(maxCellCount);
-
-  // Copying _cellPtrVector
-  LinkedList<int>::Iterator iter{cellController._cellIndexList.getIterator()};
-  while (iter.hasNext()) {
-    const int index{iter.next()};
-    _cellPtrVector[index] = std::make_unique<Cell>(*cellController._cellPtrVector[index]);
-  }
-}
+      _yearsNumber{cellController._yearsNumber} {}
 
 CellController &CellController::operator=(const CellController &cellController) noexcept {
   _mersenneTwisterEngine          = cellController._mersenneTwisterEngine;
@@ -280,24 +680,25 @@ CellController &CellController::operator=(const CellController &cellController)
   _enableDaytimes                         = cellController._enableDaytimes;
   _enableMaximizingFoodEnergy             = cellController._enableMaximizingFoodEnergy;
   _enableDeadCellPinningOnSinking         = cellController._enableDeadCellPinningOnSinking;
+  _genomeInterpreter                      = cellController._genomeInterpreter;
+  _threadCount                            = cellController._threadCount;
+  _tileWidth                              = cellController._tileWidth;
+  _tileHeight                             = cellController._tileHeight;
+  _actFlags                               = cellController._actFlags;
+  _actFunction                            = cellController._actFunction;
   _cellIndexList                          = cellController._cellIndexList;
-
-  // Allocating memory for vector of cell pointers
-  const int maxCellCount{_columns * _rows};
-  for (int i = 0; i < maxCellCount; ++i) {
-    _cellPtrVector.push_back(std::unique_ptr<Cell>{});
-  }
-  _cellPtrVector.reserve(maxCellCount);
-
-  // Copying _cellPtrVector
-  LinkedList<int>::Iterator iter{cellController._cellIndexList.getIterator()};
-  while (iter.hasNext()) {
-    const int index{iter.next()};
-    _cellPtrVector[index] = std::make_unique<Cell>(*cellController._cellPtrVector[index]);
-  }
-
-  _ticksNumber = cellController._ticksNumber;
-  _yearsNumber = cellController._yearsNumber;
+  _cells                                  = cellController._cells;
+  _takenCellTextureData                   = cellController._takenCellTextureData;
+  _genomeArena                            = cellController._genomeArena;
+  _actStamp                               = cellController._actStamp;
+  _environmentTables                      = cellController._environmentTables;
+  _ticksNumber                            = cellController._ticksNumber;
+  _yearsNumber                            = cellController._yearsNumber;
+
+  // Creating own thread pool with the same thread count
+  _threadPool = cellController._threadPool != nullptr
+                    ? std::make_unique<ThreadPool>(cellController._threadCount)
+                    : nullptr;
 
   return *this;
 }
@@ -365,9 +766,21 @@ CellController::CellController(CellController &&cellController) noexcept
       _enableMaximizingFoodEnergy{std::exchange(cellController._enableMaximizingFoodEnergy, false)},
       _enableDeadCellPinningOnSinking{
           std::exchange(cellController._enableDeadCellPinningOnSinking, false)},
-      _cellIndexList{std::exchange(cellController._cellIndexList, LinkedList<int>{})},
-      _cellPtrVector{
-          std::exchange(cellController._cellPtrVector, std::vector<std::unique_ptr<Cell>>{})},
+      _genomeInterpreter{
+          std::exchange(cellController._genomeInterpreter, GenomeInterpreters::Switch)},
+      _threadCount{std::exchange(cellController._threadCount, 0)},
+      _tileWidth{std::exchange(cellController._tileWidth, 0)},
+      _tileHeight{std::exchange(cellController._tileHeight, 0)},
+      _actFlags{std::exchange(cellController._actFlags, 0)},
+      _actFunction{std::exchange(cellController._actFunction, nullptr)},
+      _cellIndexList{std::exchange(cellController._cellIndexList, IndexList{})},
+      _cells{std::exchange(cellController._cells, CellStorage{})},
+      _takenCellTextureData{
+          std::exchange(cellController._takenCellTextureData, std::vector<CellTextureData>{})},
+      _genomeArena{std::exchange(cellController._genomeArena, GenomeArena{})},
+      _threadPool{std::exchange(cellController._threadPool, nullptr)},
+      _actStamp{std::exchange(cellController._actStamp, 0)},
+      _environmentTables{std::exchange(cellController._environmentTables, EnvironmentTables{})},
       _ticksNumber{std::exchange(cellController._ticksNumber, 0)},
       _yearsNumber{std::exchange(cellController._yearsNumber, 0)} {}
 
@@ -428,8 +841,19 @@ CellController &CellController::operator=(CellController &&cellController) noexc
   std::swap(_enableDaytimes, cellController._enableDaytimes);
   std::swap(_enableMaximizingFoodEnergy, cellController._enableMaximizingFoodEnergy);
   std::swap(_enableDeadCellPinningOnSinking, cellController._enableDeadCellPinningOnSinking);
+  std::swap(_genomeInterpreter, cellController._genomeInterpreter);
+  std::swap(_threadCount, cellController._threadCount);
+  std::swap(_tileWidth, cellController._tileWidth);
+  std::swap(_tileHeight, cellController._tileHeight);
+  std::swap(_actFlags, cellController._actFlags);
+  std::swap(_actFunction, cellController._actFunction);
   std::swap(_cellIndexList, cellController._cellIndexList);
-  std::swap(_cellPtrVector, cellController._cellPtrVector);
+  std::swap(_cells, cellController._cells);
+  std::swap(_takenCellTextureData, cellController._takenCellTextureData);
+  std::swap(_genomeArena, cellController._genomeArena);
+  std::swap(_threadPool, cellController._threadPool);
+  std::swap(_actStamp, cellController._actStamp);
+  std::swap(_environmentTables, cellController._environmentTables);
   std::swap(_ticksNumber, cellController._ticksNumber);
   std::swap(_yearsNumber, cellController._yearsNumber);
 
@@ -439,297 +863,836 @@ CellController &CellController::operator=(CellController &&cellController) noexc
 CellController::~CellController() noexcept {}
 
 void CellController::act() noexcept {
+  // Picking act() specialization (enabling flags may have been changed since the last tick)
+  updateActFunction();
+
+  // Computing tick
+  (this->*_actFunction)();
+}
+
+void CellController::updateActFunction() noexcept {
+  // act() specializations for all instructions enabled indexed by the rest flags
+  static constexpr int                         kSpecializedFlagsShift = 14;
+  static constexpr std::array<ActFunction, 8> kSpecializedActFunctions{
+      &CellController::actWithFlags<kActFlagsAllInstructions>,
+      &CellController::actWithFlags<kActFlagsAllInstructions | kActFlagZeroEnergyOrganic>,
+      &CellController::actWithFlags<kActFlagsAllInstructions |
+                                    kActFlagForcedBuddingOnMaximalEnergyLevel>,
+      &CellController::actWithFlags<kActFlagsAllInstructions | kActFlagZeroEnergyOrganic |
+                                    kActFlagForcedBuddingOnMaximalEnergyLevel>,
+      &CellController::actWithFlags<kActFlagsAllInstructions | kActFlagThreadedInterpreter>,
+      &CellController::actWithFlags<kActFlagsAllInstructions | kActFlagThreadedInterpreter |
+                                    kActFlagZeroEnergyOrganic>,
+      &CellController::actWithFlags<kActFlagsAllInstructions | kActFlagThreadedInterpreter |
+                                    kActFlagForcedBuddingOnMaximalEnergyLevel>,
+      &CellController::actWithFlags<kActFlagsAllInstructions | kActFlagThreadedInterpreter |
+                                    kActFlagZeroEnergyOrganic |
+                                    kActFlagForcedBuddingOnMaximalEnergyLevel>,
+  };
+  static_assert(kActFlagZeroEnergyOrganic == 1u << kSpecializedFlagsShift);
+  static_assert(kActFlagForcedBuddingOnMaximalEnergyLevel == 1u << (kSpecializedFlagsShift + 1));
+  static_assert(kActFlagThreadedInterpreter == 1u << (kSpecializedFlagsShift + 2));
+
+  // Collecting enabling flags bitset
+  std::uint32_t actFlags{};
+  actFlags |= _enableInstructionTurn ? kActFlagTurn : 0u;
+  actFlags |= _enableInstructionMove ? kActFlagMove : 0u;
+  actFlags |= _enableInstructionGetEnergyFromPhotosynthesis ? kActFlagGetEnergyFromPhotosynthesis
+                                                             : 0u;
+  actFlags |= _enableInstructionGetEnergyFromMinerals ? kActFlagGetEnergyFromMinerals : 0u;
+  actFlags |= _enableInstructionGetEnergyFromFood ? kActFlagGetEnergyFromFood : 0u;
+  actFlags |= _enableInstructionBud ? kActFlagBud : 0u;
+  actFlags |= _enableInstructionMutateRandomGene ? kActFlagMutateRandomGene : 0u;
+  actFlags |= _enableInstructionShareEnergy ? kActFlagShareEnergy : 0u;
+  actFlags |= _enableInstructionTouch ? kActFlagTouch : 0u;
+  actFlags |= _enableInstructionDetermineEnergyLevel ? kActFlagDetermineEnergyLevel : 0u;
+  actFlags |= _enableInstructionDetermineDepth ? kActFlagDetermineDepth : 0u;
+  actFlags |= _enableInstructionDetermineBurstOfPhotosynthesisEnergy
+                  ? kActFlagDetermineBurstOfPhotosynthesisEnergy
+                  : 0u;
+  actFlags |= _enableInstructionDetermineBurstOfMinerals ? kActFlagDetermineBurstOfMinerals : 0u;
+  actFlags |=
+      _enableInstructionDetermineBurstOfMineralEnergy ? kActFlagDetermineBurstOfMineralEnergy : 0u;
+  actFlags |= _enableZeroEnergyOrganic ? kActFlagZeroEnergyOrganic : 0u;
+  actFlags |= _enableForcedBuddingOnMaximalEnergyLevel ? kActFlagForcedBuddingOnMaximalEnergyLevel
+                                                       : 0u;
+  actFlags |=
+      _genomeInterpreter == GenomeInterpreters::Threaded ? kActFlagThreadedInterpreter : 0u;
+
+  // Keeping current specialization if nothing has changed
+  if (actFlags == _actFlags && _actFunction != nullptr) {
+    return;
+  }
+  _actFlags = actFlags;
+
+  // Using specialization if all instructions are enabled and reading flags at runtime otherwise
+  if ((actFlags & kActFlagsAllInstructions) == kActFlagsAllInstructions) {
+    _actFunction = kSpecializedActFunctions[actFlags >> kSpecializedFlagsShift];
+  } else if ((actFlags & kActFlagThreadedInterpreter) != 0) {
+    _actFunction = &CellController::actWithFlags<kActFlagsDynamic | kActFlagThreadedInterpreter>;
+  } else {
+    _actFunction = &CellController::actWithFlags<kActFlagsDynamic>;
+  }
+}
+
+const std::array<bool CellController::*, kSnapshotEnablingFlagCount>
+    &CellController::getEnablingFlagMembers() noexcept {
+  static constexpr std::array<bool CellController::*, kSnapshotEnablingFlagCount>
+      kEnablingFlagMembers{
+          &CellController::_enableInstructionTurn,
+          &CellController::_enableInstructionMove,
+          &CellController::_enableInstructionGetEnergyFromPhotosynthesis,
+          &CellController::_enableInstructionGetEnergyFromMinerals,
+          &CellController::_enableInstructionGetEnergyFromFood,
+          &CellController::_enableInstructionBud,
+          &CellController::_enableInstructionMutateRandomGene,
+          &CellController::_enableInstructionShareEnergy,
+          &CellController::_enableInstructionTouch,
+          &CellController::_enableInstructionDetermineEnergyLevel,
+          &CellController::_enableInstructionDetermineDepth,
+          &CellController::_enableInstructionDetermineBurstOfPhotosynthesisEnergy,
+          &CellController::_enableInstructionDetermineBurstOfMinerals,
+          &CellController::_enableInstructionDetermineBurstOfMineralEnergy,
+          &CellController::_enableZeroEnergyOrganic,
+          &CellController::_enableForcedBuddingOnMaximalEnergyLevel,
+          &CellController::_enableTryingToBudInUnoccupiedDirection,
+          &CellController::_enableDeathOnBuddingIfNotEnoughSpace,
+          &CellController::_enableSeasons,
+          &CellController::_enableDaytimes,
+          &CellController::_enableMaximizingFoodEnergy,
+          &CellController::_enableDeadCellPinningOnSinking,
+      };
+
+  return kEnablingFlagMembers;
+}
+
+SnapshotWorld CellController::getSnapshotWorld() const noexcept {
+  SnapshotWorld world{};
+
+  world.countOfBuds                       = _countOfBuds;
+  world.countOfPhotosynthesisEnergyBursts = _countOfPhotosynthesisEnergyBursts;
+  world.countOfMineralEnergyBursts        = _countOfMineralEnergyBursts;
+  world.countOfFoodEnergyBursts           = _countOfFoodEnergyBursts;
+  world.randomSeed                        = _randomSeed;
+  world.columns                           = _columns;
+  world.rows                              = _rows;
+  world.genomeSize                        = _genomeSize;
+  world.parameters                        = getParameters();
+  world.threadCount                       = _threadCount;
+  world.tileWidth                         = _tileWidth;
+  world.tileHeight                        = _tileHeight;
+  world.ticksNumber                       = _ticksNumber;
+  world.yearsNumber                       = _yearsNumber;
+  world.countOfLiveCells                  = _countOfLiveCells;
+  world.countOfDeadCells                  = _countOfDeadCells;
+  world.cellCount                         = static_cast<std::int32_t>(_cellIndexList.count());
+  world.areGenesPacked                    = _genomeArena.isPacked() ? 1 : 0;
+
+  return world;
+}
+
+void CellController::setSnapshotWorld(const SnapshotWorld &world) {
+  // Applying parameters (they are checked while snapshot is read), time and statistics counters
+  setParameters(world.parameters);
+  _randomSeed                        = world.randomSeed;
+  _environmentTables                 = EnvironmentTables{};
+  _ticksNumber                       = world.ticksNumber;
+  _yearsNumber                       = world.yearsNumber;
+  _countOfLiveCells                  = world.countOfLiveCells;
+  _countOfDeadCells                  = world.countOfDeadCells;
+  _countOfBuds                       = world.countOfBuds;
+  _countOfPhotosynthesisEnergyBursts = world.countOfPhotosynthesisEnergyBursts;
+  _countOfMineralEnergyBursts        = world.countOfMineralEnergyBursts;
+  _countOfFoodEnergyBursts           = world.countOfFoodEnergyBursts;
+
+  // Applying parallel tick properties and recreating thread pool if it does not fit them
+  _tileWidth  = std::max(world.tileWidth, kMinTileSize);
+  _tileHeight = world.tileHeight > 0 ? std::max(world.tileHeight, kMinTileSize) : 0;
+
+  const int  threadCount   = std::max(world.threadCount, 0);
+  const bool hasThreadPool = threadCount > 0 && _columns >= kMinTileSize * 2;
+  if (threadCount != _threadCount || (_threadPool != nullptr) != hasThreadPool) {
+    _threadCount = threadCount;
+    _threadPool  = hasThreadPool ? std::make_unique<ThreadPool>(_threadCount) : nullptr;
+  }
+
+  // Picking act() specialization for applied enabling flags
+  _actFunction = nullptr;
+  updateActFunction();
+
+  // Forgetting changed slots as state is the same as in snapshot
+  clearChangedSlots();
+}
+
+SnapshotCell CellController::getSnapshotCell(int index, bool hasGenome) const noexcept {
+  SnapshotCell cell{};
+
+  cell.index              = index;
+  cell.counter            = _cells.counters[index];
+  cell.energy             = _cells.energies[index];
+  cell.minerals           = _cells.minerals[index];
+  cell.direction          = _cells.directions[index];
+  cell.age                = _cells.ages[index];
+  cell.colorR             = _cells.colorsR[index];
+  cell.colorG             = _cells.colorsG[index];
+  cell.colorB             = _cells.colorsB[index];
+  cell.energyShareBalance = _cells.energyShareBalances[index];
+  cell.lastEnergyShare    = _cells.lastEnergyShares[index];
+  cell.isAlive            = _cells.areAlive[index];
+  cell.isPinned           = _cells.arePinned[index];
+  cell.hasGenome          = hasGenome;
+
+  return cell;
+}
+
+void CellController::copySnapshotGenome(int index, std::uint8_t *genomeData) const noexcept {
+  const int genomeSlot = _cells.genomeSlots[index];
+  if (_genomeArena.isPacked()) {
+    std::memcpy(genomeData, _genomeArena.getPackedGenome(genomeSlot),
+                sizeof(std::uint8_t) * _genomeSize);
+  } else {
+    std::memcpy(genomeData, _genomeArena.getGenome(genomeSlot),
+                sizeof(std::int32_t) * _genomeSize);
+  }
+}
+
+void CellController::setSnapshotCell(CellStorage &cells, const SnapshotCell &cell) noexcept {
+  const int index                  = cell.index;
+  cells.counters[index]            = cell.counter;
+  cells.energies[index]            = cell.energy;
+  cells.minerals[index]            = cell.minerals;
+  cells.directions[index]          = cell.direction;
+  cells.ages[index]                = cell.age;
+  cells.colorsR[index]             = cell.colorR;
+  cells.colorsG[index]             = cell.colorG;
+  cells.colorsB[index]             = cell.colorB;
+  cells.energyShareBalances[index] = cell.energyShareBalance;
+  cells.lastEnergyShares[index]    = cell.lastEnergyShare;
+  cells.areAlive[index]            = cell.isAlive != 0;
+  cells.arePinned[index]           = cell.isPinned != 0;
+  cells.areOccupied[index]         = true;
+}
+
+template <std::uint32_t kActFlags>
+void CellController::actWithFlags() noexcept {
   // Updating world time
   updateTime();
 
+  // Updating environment lookup tables
+  updateEnvironmentTables();
+
   // Updating some staticstics counters
   _countOfLiveCells = 0;
   _countOfDeadCells = 0;
 
+  // Computing cells sequentially or in tiles in parallel if there is thread pool
+  if (_threadPool == nullptr) {
+    actSequentially<kActFlags>();
+  } else {
+    actInTiles<kActFlags>();
+  }
+
+  // Performing gamma flash
+  gammaFlash();
+}
+
+template <std::uint32_t kActFlags>
+void CellController::actSequentially() noexcept {
+  // Using the shared pseudo-random numbers generator
+  ActContext context{RandomStream{&_mersenneTwisterEngine}};
+
   // Going through all cells sequently
-  LinkedList<int>::Iterator iter{_cellIndexList.getIterator()};
+  IndexList::Iterator iter{_cellIndexList.getIterator()};
   while (iter.hasNext()) {
-    const int index = iter.next();
-    Cell     &cell  = *_cellPtrVector[index];
+    actCell<kActFlags>(iter.next(), context);
+  }
+
+  // Updating statistics counters
+  addStatistics(context);
+}
 
-    ++cell._age;
+template <std::uint32_t kActFlags>
+void CellController::actInTiles() noexcept {
+  // Calculating tile grid (count of tile columns is even so colors alternate across X-axis wrap)
+  const int tileColumnCount = std::max(_columns / _tileWidth / 2 * 2, 2);
+  const int tileRowCount    = _tileHeight > 0 ? std::max(_rows / _tileHeight, 1) : 1;
+  const int tileCount       = tileColumnCount * tileRowCount;
+
+  // Making sure each cell can bud without genome arena growth while other threads read genomes
+  _genomeArena.reserve(static_cast<int>(_cellIndexList.count()));
+
+  // Updating stamp that prevents cells moved to tiles computed later from being computed twice
+  ++_actStamp;
+
+  // Computing tiles of each color at once (results do not depend on thread count
+  // as each tile has its own statistics counters and random numbers are counter-based)
+  std::vector<ActContext> contexts(tileCount);
+  for (int color = 0; color < kTileColorCount; ++color) {
+    const int firstTileColumn  = color % 2;
+    const int firstTileRow     = color / 2;
+    const int colorColumnCount = (tileColumnCount - firstTileColumn + 1) / 2;
+    const int colorRowCount    = (tileRowCount - firstTileRow + 1) / 2;
+    const int colorTileCount   = colorColumnCount * colorRowCount;
+    if (colorTileCount == 0) {
+      continue;
+    }
 
-    // If cell is dead
-    if (!cell._isAlive) {
-      // Making organic sink
-      move(cell);
+    _threadPool->run(colorTileCount, [&](int colorTile) {
+      // Calculating tile and its bounds
+      const int tileColumn = firstTileColumn + colorTile % colorColumnCount * 2;
+      const int tileRow    = firstTileRow + colorTile / colorColumnCount * 2;
+      const int tile       = tileRow * tileColumnCount + tileColumn;
+      const int minColumn  = _columns * tileColumn / tileColumnCount;
+      const int maxColumn  = _columns * (tileColumn + 1) / tileColumnCount;
+      const int minRow     = _rows * tileRow / tileRowCount;
+      const int maxRow     = _rows * (tileRow + 1) / tileRowCount;
+
+      ActContext &context = contexts[tile];
+      context.isParallel  = true;
+
+      // Going through tile cells row by row
+      for (int row = minRow; row < maxRow; ++row) {
+        for (int column = minColumn; column < maxColumn; ++column) {
+          const int index = calculateIndexByColumnAndRow(column, row);
+
+          // Skipping if there is no cell or it has already been computed
+          if (!_cells.areOccupied[index] || _cells.actStamps[index] == _actStamp) {
+            continue;
+          }
 
-      // Updating statistics counter
-      ++_countOfDeadCells;
+          // Drawing random numbers keyed by seed, time and cell index
+          context.randomStream = RandomStream{_randomSeed, RandomStreamDomains::Act, _yearsNumber,
+                                              _ticksNumber, index};
 
-      continue;
+          _cells.actStamps[index] = _actStamp;
+          actCell<kActFlags>(index, context);
+        }
+      }
+    });
+  }
+
+  // Updating statistics counters
+  for (const ActContext &context : contexts) {
+    addStatistics(context);
+  }
+
+  // Rebuilding index list as it is not updated while cells are computed in parallel
+  // (cells are pushed in reverse order so the list goes in index order)
+  _cellIndexList.clear();
+  for (int index = _columns * _rows - 1; index >= 0; --index) {
+    if (_cells.areOccupied[index]) {
+      _cellIndexList.pushFront(index);
     }
+  }
+}
+
+template <std::uint32_t kActFlags>
+void CellController::actCell(int index, ActContext &context) noexcept {
+  ++_cells.ages[index];
+  // Marking slot as changed for delta snapshots (age changes each tick)
+  // and for rendering if cell is alive (dead cell looks the same whatever its age is)
+  _cells.changes[index] |= _cells.areAlive[index] ? kSlotChangedProperties | kSlotChangedRendering
+                                                  : kSlotChangedProperties;
+
+  // If cell is dead
+  if (!_cells.areAlive[index]) {
+    // Making organic sink
+    move(index, context);
 
     // Updating statistics counter
-    _countOfLiveCells++;
-
-    // Updating cell energy
-    cell._energy--;
-    // If cell energy is less than one
-    if (cell._energy <= 0) {
-      // Turning cell into organic if zero energy organic is enabled
-      if (_enableZeroEnergyOrganic) {
-        cell._isAlive = false;
-      }
-      // Removing cell if zero energy organic is disabled
-      else {
-        removeCell(std::move(_cellPtrVector[index]));
-      }
+    ++context.countOfDeadCells;
 
-      continue;
+    return;
+  }
+
+  // Updating statistics counter
+  context.countOfLiveCells++;
+
+  // Updating cell energy
+  _cells.energies[index]--;
+  // If cell energy is less than one
+  if (_cells.energies[index] <= 0) {
+    // Turning cell into organic if zero energy organic is enabled
+    if (isActFlagEnabled<kActFlags>(kActFlagZeroEnergyOrganic, _enableZeroEnergyOrganic)) {
+      _cells.areAlive[index] = false;
     }
-    // Making cell bud if its energy greater or equals to maximal
-    if (_enableForcedBuddingOnMaximalEnergyLevel && cell._energy >= _maxEnergy - 1) {
-      bud(cell);
-      continue;
+    // Removing cell if zero energy organic is disabled
+    else {
+      removeCell(index, context);
     }
 
-    // Updating cell minerals
-    cell._minerals += calculateBurstOfMinerals(cell._index);
-    if (cell._minerals > _maxMinerals) {
-      cell._minerals = _maxMinerals;
-    }
+    return;
+  }
+  // Making cell bud if its energy greater or equals to maximal
+  if (isActFlagEnabled<kActFlags>(kActFlagForcedBuddingOnMaximalEnergyLevel,
+                                  _enableForcedBuddingOnMaximalEnergyLevel) &&
+      _cells.energies[index] >= _maxEnergy - 1) {
+    bud(index, context);
+    return;
+  }
+
+  // Updating cell minerals
+  _cells.minerals[index] += calculateBurstOfMinerals(index);
+  if (_cells.minerals[index] > _maxMinerals) {
+    _cells.minerals[index] = _maxMinerals;
+  }
 
-    // Fading last energy share
-    cell._lastEnergyShare *= kLastEnergyShareFadeMultiplier;
+  // Fading last energy share
+  _cells.lastEnergyShares[index] *= kLastEnergyShareFadeMultiplier;
 
-    // Applying random mutation
-    if (static_cast<float>(_mersenneTwisterEngine()) /
-            static_cast<float>(_mersenneTwisterEngine.max()) <
-        _randomMutationChance) {
-      mutateRandomGene(cell);
+  // Applying random mutation
+  if (context.randomStream.drawWithProbability(_randomMutationChance)) {
+    mutateRandomGene(index, context);
+  }
+
+  // Executing genome machine instructions with chosen interpreter
+  if constexpr ((kActFlags & kActFlagThreadedInterpreter) != 0) {
+    interpretGenomeWithThreadedCode<kActFlags>(index, context);
+  } else {
+    interpretGenomeWithSwitch<kActFlags>(index, context);
+  }
+}
+
+void CellController::addStatistics(const ActContext &context) noexcept {
+  _countOfLiveCells += context.countOfLiveCells;
+  _countOfDeadCells += context.countOfDeadCells;
+  _countOfBuds += context.countOfBuds;
+  _countOfPhotosynthesisEnergyBursts += context.countOfPhotosynthesisEnergyBursts;
+  _countOfMineralEnergyBursts += context.countOfMineralEnergyBursts;
+  _countOfFoodEnergyBursts += context.countOfFoodEnergyBursts;
+
+#ifdef CELLARIUM_PROFILING
+  for (int i = 0; i < kProfiledInstructionCount; ++i) {
+    _profile.instructionCounts[i] += context.profile.instructionCounts[i];
+    _profile.instructionLimitCounts[i] += context.profile.instructionLimitCounts[i];
+  }
+  for (int i = 0; i < static_cast<int>(ProfiledHandlers::Size); ++i) {
+    _profile.handlerCallCounts[i] += context.profile.handlerCallCounts[i];
+    _profile.handlerSampleCounts[i] += context.profile.handlerSampleCounts[i];
+    _profile.handlerSampleCycles[i] += context.profile.handlerSampleCycles[i];
+  }
+#endif
+}
+
+template <std::uint32_t kActFlags>
+int CellController::interpretGenomeWithSwitch(int index, ActContext &context) noexcept {
+  // Executing genome machine instructions with maximum instructions per tick limit
+  for (int i = 0; i < _maxInstructionsPerTick; ++i) {
+    // Getting current instruction from genome
+    int instuction = _genomeArena.getGene(_cells.genomeSlots[index], _cells.counters[index]);
+    PROFILE_INSTRUCTION(context, instuction);
+
+    // Performing appropriate instruction
+    switch (static_cast<CellInstructions>(instuction)) {
+      // Do nothing
+      case CellInstructions::DoNothing: {
+        incrementGenomCounter(index);
+      } break;
+      // Turning
+      case CellInstructions::Turn: {
+        if (isActFlagEnabled<kActFlags>(kActFlagTurn, _enableInstructionTurn)) {
+          turn(index);
+        }
+        incrementGenomCounter(index);
+      } break;
+      // Moving (no more instructions permitted)
+      case CellInstructions::Move: {
+        if (isActFlagEnabled<kActFlags>(kActFlagMove, _enableInstructionMove)) {
+          i     = _maxInstructionsPerTick;
+          index = move(index, context);
+        }
+        incrementGenomCounter(index);
+      } break;
+      // Getting energy from photosynthesis (no more instructions permitted)
+      case CellInstructions::GetEnergyFromPhotosynthesis: {
+        if (isActFlagEnabled<kActFlags>(kActFlagGetEnergyFromPhotosynthesis,
+                                        _enableInstructionGetEnergyFromPhotosynthesis)) {
+          i = _maxInstructionsPerTick;
+          getEnergyFromPhotosynthesis(index, context);
+        }
+        incrementGenomCounter(index);
+      } break;
+      // Getting energy from minerals (no more instructions permitted)
+      case CellInstructions::GetEnergyFromMinerals: {
+        if (isActFlagEnabled<kActFlags>(kActFlagGetEnergyFromMinerals,
+                                        _enableInstructionGetEnergyFromMinerals)) {
+          i = _maxInstructionsPerTick;
+          getEnergyFromMinerals(index, context);
+        }
+        incrementGenomCounter(index);
+      } break;
+      // Getting energy from food (no more instructions permitted)
+      case CellInstructions::GetEnergyFromFood: {
+        if (isActFlagEnabled<kActFlags>(kActFlagGetEnergyFromFood,
+                                        _enableInstructionGetEnergyFromFood)) {
+          i = _maxInstructionsPerTick;
+          getEnergyFromFood(index, context);
+        }
+        incrementGenomCounter(index);
+      } break;
+      // Budding (no more instructions permitted)
+      case CellInstructions::Bud: {
+        if (isActFlagEnabled<kActFlags>(kActFlagBud, _enableInstructionBud)) {
+          i = _maxInstructionsPerTick;
+          bud(index, context);
+        }
+        incrementGenomCounter(index);
+      } break;
+      // Making random gene mutate (no more instructions permitted)
+      case CellInstructions::MutateRandomGene: {
+        if (isActFlagEnabled<kActFlags>(kActFlagMutateRandomGene,
+                                        _enableInstructionMutateRandomGene)) {
+          i = _maxInstructionsPerTick;
+          mutateRandomGene(index, context);
+        }
+        incrementGenomCounter(index);
+      } break;
+      // Sharing energy (no more instructions permitted)
+      case CellInstructions::ShareEnergy: {
+        if (isActFlagEnabled<kActFlags>(kActFlagShareEnergy, _enableInstructionShareEnergy)) {
+          i = _maxInstructionsPerTick;
+          shareEnergy(index);
+        }
+        incrementGenomCounter(index);
+      } break;
+      // Looking forward (conditional instruction)
+      case CellInstructions::Touch: {
+        if (isActFlagEnabled<kActFlags>(kActFlagTouch, _enableInstructionTouch)) {
+          touch(index, context);
+        } else {
+          incrementGenomCounter(index);
+        }
+      } break;
+      // Determining own energy level (conditional instruction)
+      case CellInstructions::DetermineEnergyLevel: {
+        if (isActFlagEnabled<kActFlags>(kActFlagDetermineEnergyLevel,
+                                        _enableInstructionDetermineEnergyLevel)) {
+          determineEnergyLevel(index);
+        } else {
+          incrementGenomCounter(index);
+        }
+      } break;
+      // Determining own depth (conditional instruction)
+      case CellInstructions::DetermineDepth: {
+        if (isActFlagEnabled<kActFlags>(kActFlagDetermineDepth, _enableInstructionDetermineDepth)) {
+          determineDepth(index);
+        } else {
+          incrementGenomCounter(index);
+        }
+      } break;
+      // Determining available energy from photosynthesis (conditional instruction)
+      case CellInstructions::DetermineBurstOfPhotosynthesisEnergy: {
+        if (isActFlagEnabled<kActFlags>(kActFlagDetermineBurstOfPhotosynthesisEnergy,
+                                        _enableInstructionDetermineBurstOfPhotosynthesisEnergy)) {
+          determineBurstOfPhotosynthesisEnergy(index);
+        } else {
+          incrementGenomCounter(index);
+        }
+      } break;
+      // Determining available minerals (conditional instruction)
+      case CellInstructions::DetermineBurstOfMinerals: {
+        if (isActFlagEnabled<kActFlags>(kActFlagDetermineBurstOfMinerals,
+                                        _enableInstructionDetermineBurstOfMinerals)) {
+          determineBurstOfMinerals(index);
+        } else {
+          incrementGenomCounter(index);
+        }
+      } break;
+      // Determining available energy from minerals (conditional instruction)
+      case CellInstructions::DetermineBurstOfMineralEnergy: {
+        if (isActFlagEnabled<kActFlags>(kActFlagDetermineBurstOfMineralEnergy,
+                                        _enableInstructionDetermineBurstOfMineralEnergy)) {
+          determineBurstOfMineralEnergy(index);
+        } else {
+          incrementGenomCounter(index);
+        }
+      } break;
+      // Unconditional jump
+      default: {
+        addGenToCounter(index);
+      } break;
     }
 
-    // Executing genome machine instructions with maximum instructions per tick limit
-    for (int i = 0; i < _maxInstructionsPerTick; ++i) {
-      // Getting current instruction from genome
-      int instuction = cell._genome[cell._counter];
-
-      // Performing appropriate instruction
-      switch (static_cast<CellInstructions>(instuction)) {
-        // Do nothing
-        case CellInstructions::DoNothing: {
-          incrementGenomCounter(cell);
-        } break;
-        // Turning
-        case CellInstructions::Turn: {
-          if (_enableInstructionTurn) {
-            turn(cell);
-          }
-          incrementGenomCounter(cell);
-        } break;
-        // Moving (no more instructions permitted)
-        case CellInstructions::Move: {
-          if (_enableInstructionMove) {
-            i = _maxInstructionsPerTick;
-            move(cell);
-          }
-          incrementGenomCounter(cell);
-        } break;
-        // Getting energy from photosynthesis (no more instructions permitted)
-        case CellInstructions::GetEnergyFromPhotosynthesis: {
-          if (_enableInstructionGetEnergyFromPhotosynthesis) {
-            i = _maxInstructionsPerTick;
-            getEnergyFromPhotosynthesis(cell);
-          }
-          incrementGenomCounter(cell);
-        } break;
-        // Getting energy from minerals (no more instructions permitted)
-        case CellInstructions::GetEnergyFromMinerals: {
-          if (_enableInstructionGetEnergyFromMinerals) {
-            i = _maxInstructionsPerTick;
-            getEnergyFromMinerals(cell);
-          }
-          incrementGenomCounter(cell);
-        } break;
-        // Getting energy from food (no more instructions permitted)
-        case CellInstructions::GetEnergyFromFood: {
-          if (_enableInstructionGetEnergyFromFood) {
-            i = _maxInstructionsPerTick;
-            getEnergyFromFood(cell);
-          }
-          incrementGenomCounter(cell);
-        } break;
-        // Budding (no more instructions permitted)
-        case CellInstructions::Bud: {
-          if (_enableInstructionBud) {
-            i = _maxInstructionsPerTick;
-            bud(cell);
-          }
-          incrementGenomCounter(cell);
-        } break;
-        // Making random gene mutate (no more instructions permitted)
-        case CellInstructions::MutateRandomGene: {
-          if (_enableInstructionMutateRandomGene) {
-            i = _maxInstructionsPerTick;
-            mutateRandomGene(cell);
-          }
-          incrementGenomCounter(cell);
-        } break;
-        // Sharing energy (no more instructions permitted)
-        case CellInstructions::ShareEnergy: {
-          if (_enableInstructionShareEnergy) {
-            i = _maxInstructionsPerTick;
-            shareEnergy(cell);
-          }
-          incrementGenomCounter(cell);
-        } break;
-        // Looking forward (conditional instruction)
-        case CellInstructions::Touch: {
-          if (_enableInstructionTouch) {
-            touch(cell);
-          } else {
-            incrementGenomCounter(cell);
-          }
-        } break;
-        // Determining own energy level (conditional instruction)
-        case CellInstructions::DetermineEnergyLevel: {
-          if (_enableInstructionDetermineEnergyLevel) {
-            determineEnergyLevel(cell);
-          } else {
-            incrementGenomCounter(cell);
-          }
-        } break;
-        // Determining own depth (conditional instruction)
-        case CellInstructions::DetermineDepth: {
-          if (_enableInstructionDetermineDepth) {
-            determineDepth(cell);
-          } else {
-            incrementGenomCounter(cell);
-          }
-        } break;
-        // Determining available energy from photosynthesis (conditional instruction)
-        case CellInstructions::DetermineBurstOfPhotosynthesisEnergy: {
-          if (_enableInstructionDetermineBurstOfPhotosynthesisEnergy) {
-            determineBurstOfPhotosynthesisEnergy(cell);
-          } else {
-            incrementGenomCounter(cell);
-          }
-        } break;
-        // Determining available minerals (conditional instruction)
-        case CellInstructions::DetermineBurstOfMinerals: {
-          if (_enableInstructionDetermineBurstOfMinerals) {
-            determineBurstOfMinerals(cell);
-          } else {
-            incrementGenomCounter(cell);
-          }
-        } break;
-        // Determining available energy from minerals (conditional instruction)
-        case CellInstructions::DetermineBurstOfMineralEnergy: {
-          if (_enableInstructionDetermineBurstOfMineralEnergy) {
-            determineBurstOfMineralEnergy(cell);
-          } else {
-            incrementGenomCounter(cell);
-          }
-        } break;
-        // Unconditional jump
-        default: {
-          addGenToCounter(cell);
-        } break;
-      }
+    // Counting instruction if it is the last permitted one and not a final one
+    if (i == _maxInstructionsPerTick - 1) {
+      PROFILE_INSTRUCTION_LIMIT(context, instuction);
     }
   }
 
-  // Performing gamma flash
-  gammaFlash();
+  return index;
 }
 
-void CellController::render(CellRenderingData *cellRenderingData, int cellRenderingMode) {
-  // Local constants
-  static constexpr float kMinColor{0.0f};
-  static constexpr float kHalfColor{0.5f};
-  static constexpr float kThreeQuartersColor{0.75f};
-  static constexpr float kMaxColor{1.0f};
-  static constexpr float kMaxAge{1000.0f};
+#if defined(__GNUC__) || defined(__clang__)
+// Labels as values and computed goto are GNU extensions
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+template <std::uint32_t kActFlags>
+int CellController::interpretGenomeWithThreadedCode(int index, ActContext &context) noexcept {
+  // Instruction handler addresses in CellInstructions order with unconditional jump at the end
+  static const void *const kInstructionLabels[] = {
+      &&doNothing,
+      &&turn,
+      &&move,
+      &&getEnergyFromPhotosynthesis,
+      &&getEnergyFromMinerals,
+      &&getEnergyFromFood,
+      &&bud,
+      &&mutateRandomGene,
+      &&shareEnergy,
+      &&touch,
+      &&determineEnergyLevel,
+      &&determineDepth,
+      &&determineBurstOfPhotosynthesisEnergy,
+      &&determineBurstOfMinerals,
+      &&determineBurstOfMineralEnergy,
+      &&jump,
+  };
+  static constexpr unsigned int kJumpLabelIndex =
+      static_cast<unsigned int>(CellInstructions::Size);
+  static_assert(sizeof(kInstructionLabels) / sizeof(kInstructionLabels[0]) == kJumpLabelIndex + 1);
+
+  int          instructionCount{};
+  unsigned int instruction{};
+
+// Returns if maximum instructions per tick limit is reached, jumps to next instruction otherwise
+// (limit is counted for the last executed instruction so there is none if limit is not positive)
+#define DISPATCH_NEXT_INSTRUCTION()                                                        \
+  if (instructionCount++ >= _maxInstructionsPerTick) {                                     \
+    if (instructionCount > 1) {                                                            \
+      PROFILE_INSTRUCTION_LIMIT(context, static_cast<int>(instruction));                   \
+    }                                                                                      \
+    return index;                                                                          \
+  }                                                                                        \
+  instruction = static_cast<unsigned int>(                                                 \
+      _genomeArena.getGene(_cells.genomeSlots[index], _cells.counters[index]));            \
+  PROFILE_INSTRUCTION(context, static_cast<int>(instruction));                             \
+  goto *kInstructionLabels[instruction < kJumpLabelIndex ? instruction : kJumpLabelIndex];
+
+  DISPATCH_NEXT_INSTRUCTION();
+
+  // Do nothing
+doNothing:
+  incrementGenomCounter(index);
+  DISPATCH_NEXT_INSTRUCTION();
+
+  // Turning
+turn:
+  if (isActFlagEnabled<kActFlags>(kActFlagTurn, _enableInstructionTurn)) {
+    turn(index);
+  }
+  incrementGenomCounter(index);
+  DISPATCH_NEXT_INSTRUCTION();
+
+  // Moving (no more instructions permitted)
+move:
+  if (isActFlagEnabled<kActFlags>(kActFlagMove, _enableInstructionMove)) {
+    index = move(index, context);
+    incrementGenomCounter(index);
+    return index;
+  }
+  incrementGenomCounter(index);
+  DISPATCH_NEXT_INSTRUCTION();
+
+  // Getting energy from photosynthesis (no more instructions permitted)
+getEnergyFromPhotosynthesis:
+  if (isActFlagEnabled<kActFlags>(kActFlagGetEnergyFromPhotosynthesis,
+                                  _enableInstructionGetEnergyFromPhotosynthesis)) {
+    getEnergyFromPhotosynthesis(index, context);
+    incrementGenomCounter(index);
+    return index;
+  }
+  incrementGenomCounter(index);
+  DISPATCH_NEXT_INSTRUCTION();
+
+  // Getting energy from minerals (no more instructions permitted)
+getEnergyFromMinerals:
+  if (isActFlagEnabled<kActFlags>(kActFlagGetEnergyFromMinerals,
+                                  _enableInstructionGetEnergyFromMinerals)) {
+    getEnergyFromMinerals(index, context);
+    incrementGenomCounter(index);
+    return index;
+  }
+  incrementGenomCounter(index);
+  DISPATCH_NEXT_INSTRUCTION();
+
+  // Getting energy from food (no more instructions permitted)
+getEnergyFromFood:
+  if (isActFlagEnabled<kActFlags>(kActFlagGetEnergyFromFood, _enableInstructionGetEnergyFromFood)) {
+    getEnergyFromFood(index, context);
+    incrementGenomCounter(index);
+    return index;
+  }
+  incrementGenomCounter(index);
+  DISPATCH_NEXT_INSTRUCTION();
+
+  // Budding (no more instructions permitted)
+bud:
+  if (isActFlagEnabled<kActFlags>(kActFlagBud, _enableInstructionBud)) {
+    bud(index, context);
+    incrementGenomCounter(index);
+    return index;
+  }
+  incrementGenomCounter(index);
+  DISPATCH_NEXT_INSTRUCTION();
+
+  // Making random gene mutate (no more instructions permitted)
+mutateRandomGene:
+  if (isActFlagEnabled<kActFlags>(kActFlagMutateRandomGene, _enableInstructionMutateRandomGene)) {
+    mutateRandomGene(index, context);
+    incrementGenomCounter(index);
+    return index;
+  }
+  incrementGenomCounter(index);
+  DISPATCH_NEXT_INSTRUCTION();
+
+  // Sharing energy (no more instructions permitted)
+shareEnergy:
+  if (isActFlagEnabled<kActFlags>(kActFlagShareEnergy, _enableInstructionShareEnergy)) {
+    shareEnergy(index);
+    incrementGenomCounter(index);
+    return index;
+  }
+  incrementGenomCounter(index);
+  DISPATCH_NEXT_INSTRUCTION();
+
+  // Looking forward (conditional instruction)
+touch:
+  if (isActFlagEnabled<kActFlags>(kActFlagTouch, _enableInstructionTouch)) {
+    touch(index, context);
+  } else {
+    incrementGenomCounter(index);
+  }
+  DISPATCH_NEXT_INSTRUCTION();
+
+  // Determining own energy level (conditional instruction)
+determineEnergyLevel:
+  if (isActFlagEnabled<kActFlags>(kActFlagDetermineEnergyLevel,
+                                  _enableInstructionDetermineEnergyLevel)) {
+    determineEnergyLevel(index);
+  } else {
+    incrementGenomCounter(index);
+  }
+  DISPATCH_NEXT_INSTRUCTION();
 
+  // Determining own depth (conditional instruction)
+determineDepth:
+  if (isActFlagEnabled<kActFlags>(kActFlagDetermineDepth, _enableInstructionDetermineDepth)) {
+    determineDepth(index);
+  } else {
+    incrementGenomCounter(index);
+  }
+  DISPATCH_NEXT_INSTRUCTION();
+
+  // Determining available energy from photosynthesis (conditional instruction)
+determineBurstOfPhotosynthesisEnergy:
+  if (isActFlagEnabled<kActFlags>(kActFlagDetermineBurstOfPhotosynthesisEnergy,
+                                  _enableInstructionDetermineBurstOfPhotosynthesisEnergy)) {
+    determineBurstOfPhotosynthesisEnergy(index);
+  } else {
+    incrementGenomCounter(index);
+  }
+  DISPATCH_NEXT_INSTRUCTION();
+
+  // Determining available minerals (conditional instruction)
+determineBurstOfMinerals:
+  if (isActFlagEnabled<kActFlags>(kActFlagDetermineBurstOfMinerals,
+                                  _enableInstructionDetermineBurstOfMinerals)) {
+    determineBurstOfMinerals(index);
+  } else {
+    incrementGenomCounter(index);
+  }
+  DISPATCH_NEXT_INSTRUCTION();
+
+  // Determining available energy from minerals (conditional instruction)
+determineBurstOfMineralEnergy:
+  if (isActFlagEnabled<kActFlags>(kActFlagDetermineBurstOfMineralEnergy,
+                                  _enableInstructionDetermineBurstOfMineralEnergy)) {
+    determineBurstOfMineralEnergy(index);
+  } else {
+    incrementGenomCounter(index);
+  }
+  DISPATCH_NEXT_INSTRUCTION();
+
+  // Unconditional jump
+jump:
+  addGenToCounter(index);
+  DISPATCH_NEXT_INSTRUCTION();
+
+#undef DISPATCH_NEXT_INSTRUCTION
+}
+#pragma GCC diagnostic pop
+#else
+template <std::uint32_t kActFlags>
+int CellController::interpretGenomeWithThreadedCode(int index, ActContext &context) noexcept {
+  // Falling back to switch because computed goto is not supported by compiler
+  return interpretGenomeWithSwitch<kActFlags>(index, context);
+}
+#endif
+
+void CellController::render(CellRenderingData *cellRenderingData, int cellRenderingMode) {
   // Initializing count of RenderingData objects
   int renderingDataCount{};
 
-  // Rendering each cell and putting its rendering data to array
-  LinkedList<int>::Iterator iter{_cellIndexList.getIterator()};
-  while (iter.hasNext()) {
-    const Cell &cell = *_cellPtrVector[iter.next()];
+  // Rendering each cell going through cell storage columns sequently
+  // and putting its rendering data to array
+  const int maxCellCount{_columns * _rows};
+  for (int index = 0; index < maxCellCount; ++index) {
+    // Skipping if there is no cell
+    if (!_cellIndexList.contains(index)) {
+      continue;
+    }
 
     float colorR{}, colorG{}, colorB{};
-
-    // If cell is selected
-    if (_selectedCellPtr == &cell) {
-      colorR = kMinColor;
-      colorG = kMinColor;
-      colorB = kMinColor;
-    }
-    // Else if cell is alive
-    else if (cell._isAlive) {
-      // Choosing appropriate cell rendering mode
-      switch (static_cast<CellRenderingModes>(cellRenderingMode)) {
-        // Diet mode
-        case CellRenderingModes::Diet: {
-          // Normalizing color and reducing it to range from 0 to 255
-          colorR = static_cast<float>(cell._colorR);
-          colorG = static_cast<float>(cell._colorG);
-          colorB = static_cast<float>(cell._colorB);
-
-          float colorVectorLength = std::sqrt(colorR * colorR + colorG * colorG + colorB * colorB);
-
-          if (colorVectorLength < 1.0f) {
-            colorR = kMinColor;
-            colorG = kMinColor;
-            colorB = kMinColor;
-          } else {
-            colorR /= colorVectorLength;
-            colorG /= colorVectorLength;
-            colorB /= colorVectorLength;
-          }
-        } break;
-        // Energy level mode
-        case CellRenderingModes::EnergyLevel: {
-          colorR = kMaxColor;
-          colorG = map(cell._energy, 0.0f, _maxEnergy, kMaxColor, kMinColor);
-          colorB = kMinColor;
-        } break;
-        // Energy sharing balance mode
-        case CellRenderingModes::EnergySharingBalance: {
-          colorR =
-              mapClamp(cell._energyShareBalance, -_maxEnergy, _maxEnergy, kMaxColor, kMinColor);
-          colorG =
-              mapClamp(cell._energyShareBalance, -_maxEnergy, _maxEnergy, kHalfColor, kMaxColor);
-          colorB =
-              mapClamp(cell._energyShareBalance, -_maxEnergy, _maxEnergy, kMinColor, kMaxColor);
-        } break;
-        // Last energy share mode
-        case CellRenderingModes::LastEnergyShare: {
-          colorR = map(cell._lastEnergyShare, -1.0f, 1.0f, kMaxColor, kMinColor);
-          colorG = map(cell._lastEnergyShare, -1.0f, 1.0f, kHalfColor, kMaxColor);
-          colorB = map(cell._lastEnergyShare, -1.0f, 1.0f, kMinColor, kMaxColor);
-        } break;
-        // Age mode
-        case CellRenderingModes::Age: {
-          colorR = mapClamp(cell._age, 0.0f, kMaxAge, kMinColor, kMaxColor);
-          colorG = mapClamp(cell._age, 0.0f, kMaxAge, kMaxColor, kMinColor);
-          colorB = mapClamp(cell._age, 0.0f, kMaxAge, kMaxColor, kMinColor);
-        } break;
-      }
-    }
-    // Else if cell is dead
-    else {
-      colorR = kThreeQuartersColor;
-      colorG = kThreeQuartersColor;
-      colorB = kThreeQuartersColor;
-    }
+    calculateCellColor(index, cellRenderingMode, colorR, colorG, colorB);
 
     // Putting cell rendering data to array
-    cellRenderingData[renderingDataCount] = CellRenderingData{cell._index, colorR, colorG, colorB};
+    cellRenderingData[renderingDataCount] = CellRenderingData{index, colorR, colorG, colorB};
 
     // Incrementing count of RenderingData objects
     ++renderingDataCount;
   }
 }
 
+void CellController::renderTexture(CellTextureData *cellTextureData, const std::uint8_t *rowFlags) {
+  // Copying attributes of each slot of flagged rows taken by takeChangedRows()
+  // (colors are computed from them by shader, so they do not depend on cell rendering mode)
+  for (int row = 0; row < _rows; ++row) {
+    // Skipping row if it is not flagged
+    if (rowFlags != nullptr && rowFlags[row] == 0) {
+      continue;
+    }
+
+    std::memcpy(cellTextureData + row * _columns, _takenCellTextureData.data() + row * _columns,
+                sizeof(CellTextureData) * _columns);
+  }
+}
+
+void CellController::takeChangedRows(std::uint8_t *rowFlags) noexcept {
+  // Flagging rows with slots whose texture data differs from the taken one and forgetting changes
+  // (live cells are marked each tick, but their attributes are quantized to 8 bits,
+  // so most of them look the same as a tick before)
+  for (int row = 0; row < _rows; ++row) {
+    bool      isRowChanged{};
+    const int rowEnd{(row + 1) * _columns};
+    for (int index = row * _columns; index < rowEnd; ++index) {
+      if ((_cells.changes[index] & kSlotChangedRendering) == 0) {
+        continue;
+      }
+      _cells.changes[index] &= static_cast<std::uint8_t>(~kSlotChangedRendering);
+
+      const CellTextureData data{calculateCellTextureData(index)};
+      if (std::memcmp(&data, &_takenCellTextureData[index], sizeof(CellTextureData)) != 0) {
+        _takenCellTextureData[index] = data;
+        isRowChanged                 = true;
+      }
+    }
+
+    if (isRowChanged) {
+      rowFlags[row] = 1;
+    }
+  }
+}
+
 size_t CellController::getCellCount() const noexcept { return _cellIndexList.count(); }
 
 float CellController::getSunPosition() const noexcept {
@@ -777,14 +1740,508 @@ CellController::Statistics CellController::getSimulationStatistics() const noexc
   statistics.countOfPhotosynthesisEnergyBursts = _countOfPhotosynthesisEnergyBursts;
   statistics.countOfMineralEnergyBursts        = _countOfMineralEnergyBursts;
   statistics.countOfFoodEnergyBursts           = _countOfFoodEnergyBursts;
+#ifdef CELLARIUM_PROFILING
+  statistics.profile = _profile;
+#endif
 
   return statistics;
 }
 
+CellController::CellGridView CellController::getCellGridView() const noexcept {
+  CellGridView cellGridView{};
+
+  cellGridView.columns     = _columns;
+  cellGridView.rows        = _rows;
+  cellGridView.areOccupied = _cells.areOccupied.data();
+  cellGridView.areAlive    = _cells.areAlive.data();
+  cellGridView.energies    = _cells.energies.data();
+  cellGridView.minerals    = _cells.minerals.data();
+  cellGridView.directions  = _cells.directions.data();
+  cellGridView.ages        = _cells.ages.data();
+  cellGridView.colorsR     = _cells.colorsR.data();
+  cellGridView.colorsG     = _cells.colorsG.data();
+  cellGridView.colorsB     = _cells.colorsB.data();
+
+  return cellGridView;
+}
+
+std::vector<std::uint8_t> CellController::saveSnapshot() const {
+  // Getting textual state of pseudo-random numbers generator
+  std::ostringstream randomEngineStream{};
+  randomEngineStream << _mersenneTwisterEngine;
+  const std::string randomEngineState{randomEngineStream.str()};
+
+  // Creating snapshot of all the cells with their genomes
+  const int         cellCount = static_cast<int>(_cellIndexList.count());
+  const std::size_t genomeDataSize =
+      (_genomeArena.isPacked() ? sizeof(std::uint8_t) : sizeof(std::int32_t)) * _genomeSize;
+  SnapshotHeader            header{};
+  std::vector<std::uint8_t> snapshot{createSnapshot(kSnapshotMagic,
+                                                    {sizeof(SnapshotWorld),
+                                                     randomEngineState.size(),
+                                                     sizeof(SnapshotCell) * cellCount,
+                                                     genomeDataSize * cellCount, 0, 0},
+                                                    header)};
+
+  // Copying world record and pseudo-random numbers generator state
+  const SnapshotWorld world{getSnapshotWorld()};
+  std::memcpy(getSnapshotSection(snapshot.data(), header, SnapshotSections::World), &world,
+              sizeof(SnapshotWorld));
+  std::memcpy(getSnapshotSection(snapshot.data(), header, SnapshotSections::RandomEngine),
+              randomEngineState.data(), randomEngineState.size());
+
+  // Copying cells and their genomes in computing order
+  std::uint8_t *cellData   = getSnapshotSection(snapshot.data(), header, SnapshotSections::Cells);
+  std::uint8_t *genomeData = getSnapshotSection(snapshot.data(), header, SnapshotSections::Genomes);
+  IndexList::ConstIterator iter{_cellIndexList.getIterator()};
+  while (iter.hasNext()) {
+    const int index = iter.next();
+
+    const SnapshotCell cell{getSnapshotCell(index, true)};
+    std::memcpy(cellData, &cell, sizeof(SnapshotCell));
+    cellData += sizeof(SnapshotCell);
+
+    copySnapshotGenome(index, genomeData);
+    genomeData += genomeDataSize;
+  }
+
+  finishSnapshot(header, snapshot);
+
+  return snapshot;
+}
+
+std::vector<std::uint8_t> CellController::saveDeltaSnapshot(std::uint64_t parentChecksum) const {
+  // Getting textual state of pseudo-random numbers generator
+  std::ostringstream randomEngineStream{};
+  randomEngineStream << _mersenneTwisterEngine;
+  const std::string randomEngineState{randomEngineStream.str()};
+
+  // Counting changed slots which are occupied (with changed genomes) and which are not
+  const int maxCellCount{_columns * _rows};
+  int       changedCellCount{};
+  int       changedGenomeCount{};
+  int       clearedSlotCount{};
+  for (int index = 0; index < maxCellCount; ++index) {
+    if ((_cells.changes[index] & kSlotChangedSnapshotMask) == 0) {
+      continue;
+    }
+    if (!_cells.areOccupied[index]) {
+      ++clearedSlotCount;
+      continue;
+    }
+    ++changedCellCount;
+    changedGenomeCount += (_cells.changes[index] & kSlotChangedGenome) != 0 ? 1 : 0;
+  }
+
+  // Creating delta snapshot of changed slots and order of all the cells
+  const int         cellCount = static_cast<int>(_cellIndexList.count());
+  const std::size_t genomeDataSize =
+      (_genomeArena.isPacked() ? sizeof(std::uint8_t) : sizeof(std::int32_t)) * _genomeSize;
+  SnapshotHeader            header{};
+  std::vector<std::uint8_t> deltaSnapshot{
+      createSnapshot(kDeltaSnapshotMagic,
+                     {sizeof(SnapshotWorld), randomEngineState.size(),
+                      sizeof(SnapshotCell) * changedCellCount, genomeDataSize * changedGenomeCount,
+                      sizeof(std::int32_t) * cellCount, sizeof(std::int32_t) * clearedSlotCount},
+                     header)};
+  header.parentChecksum = parentChecksum;
+
+  // Copying world record and pseudo-random numbers generator state
+  const SnapshotWorld world{getSnapshotWorld()};
+  std::memcpy(getSnapshotSection(deltaSnapshot.data(), header, SnapshotSections::World), &world,
+              sizeof(SnapshotWorld));
+  std::memcpy(getSnapshotSection(deltaSnapshot.data(), header, SnapshotSections::RandomEngine),
+              randomEngineState.data(), randomEngineState.size());
+
+  // Copying changed cells with their changed genomes and changed slots which are not occupied
+  std::uint8_t *cellData =
+      getSnapshotSection(deltaSnapshot.data(), header, SnapshotSections::Cells);
+  std::uint8_t *genomeData =
+      getSnapshotSection(deltaSnapshot.data(), header, SnapshotSections::Genomes);
+  std::uint8_t *clearedSlotData =
+      getSnapshotSection(deltaSnapshot.data(), header, SnapshotSections::ClearedSlots);
+  for (int index = 0; index < maxCellCount; ++index) {
+    if ((_cells.changes[index] & kSlotChangedSnapshotMask) == 0) {
+      continue;
+    }
+
+    if (!_cells.areOccupied[index]) {
+      const std::int32_t clearedSlot = index;
+      std::memcpy(clearedSlotData, &clearedSlot, sizeof(std::int32_t));
+      clearedSlotData += sizeof(std::int32_t);
+      continue;
+    }
+
+    const bool         hasGenome = (_cells.changes[index] & kSlotChangedGenome) != 0;
+    const SnapshotCell cell{getSnapshotCell(index, hasGenome)};
+    std::memcpy(cellData, &cell, sizeof(SnapshotCell));
+    cellData += sizeof(SnapshotCell);
+
+    if (hasGenome) {
+      copySnapshotGenome(index, genomeData);
+      genomeData += genomeDataSize;
+    }
+  }
+
+  // Copying computing order of all the cells
+  std::uint8_t *cellOrderData =
+      getSnapshotSection(deltaSnapshot.data(), header, SnapshotSections::CellOrder);
+  IndexList::ConstIterator iter{_cellIndexList.getIterator()};
+  while (iter.hasNext()) {
+    const std::int32_t index = iter.next();
+    std::memcpy(cellOrderData, &index, sizeof(std::int32_t));
+    cellOrderData += sizeof(std::int32_t);
+  }
+
+  finishSnapshot(header, deltaSnapshot);
+
+  return deltaSnapshot;
+}
+
+void CellController::clearChangedSlots() noexcept {
+  // Keeping flags of slots changed for rendering as they are cleared when slots are rendered
+  for (std::uint8_t &change : _cells.changes) {
+    change &= kSlotChangedRendering;
+  }
+}
+
+int CellController::loadSnapshot(const std::uint8_t *snapshot, size_t snapshotSize) {
+  // Reading and checking header, world record and pseudo-random numbers generator state
+  SnapshotHeader header{};
+  SnapshotWorld  world{};
+  std::mt19937   mersenneTwisterEngine{};
+  if (readSnapshotHeader(snapshot, snapshotSize, kSnapshotMagic, header, world,
+                         mersenneTwisterEngine) != 0) {
+    return -1;
+  }
+
+  // Checking cell and genome section sizes
+  const std::size_t genomeDataSize =
+      (world.areGenesPacked != 0 ? sizeof(std::uint8_t) : sizeof(std::int32_t)) *
+      world.genomeSize;
+  if (header.sections[static_cast<int>(SnapshotSections::Cells)].size !=
+          sizeof(SnapshotCell) * world.cellCount ||
+      header.sections[static_cast<int>(SnapshotSections::Genomes)].size !=
+          genomeDataSize * world.cellCount) {
+    std::cout << "error: snapshot cell sections are corrupted" << std::endl;
+    return -1;
+  }
+
+  // Reading cells in reverse computing order as they are pushed to the front of index list
+  const std::uint8_t *cellData   = getSnapshotSection(snapshot, header, SnapshotSections::Cells);
+  const std::uint8_t *genomeData = getSnapshotSection(snapshot, header, SnapshotSections::Genomes);
+  const int           maxCellCount{world.columns * world.rows};
+  IndexList           cellIndexList{maxCellCount};
+  CellStorage         cells{maxCellCount};
+  GenomeArena         genomeArena{world.genomeSize, world.areGenesPacked != 0};
+  genomeArena.reserve(world.cellCount);
+  for (int i = world.cellCount - 1; i >= 0; --i) {
+    SnapshotCell cell{};
+    std::memcpy(&cell, cellData + sizeof(SnapshotCell) * i, sizeof(SnapshotCell));
+    if (!isSnapshotCellValid(cell, genomeData + genomeDataSize * i, world) ||
+        cellIndexList.pushFront(cell.index) != 0) {
+      std::cout << "error: snapshot cell " << i << " is corrupted" << std::endl;
+      return -1;
+    }
+
+    // Copying cell properties and genome
+    setSnapshotCell(cells, cell);
+    cells.genomeSlots[cell.index] = genomeArena.allocate();
+    setSnapshotGenome(genomeArena, cells.genomeSlots[cell.index], genomeData + genomeDataSize * i);
+  }
+
+  // Replacing simulation state as snapshot is valid
+  _mersenneTwisterEngine = mersenneTwisterEngine;
+  _columns               = world.columns;
+  _rows                  = world.rows;
+  _genomeSize            = world.genomeSize;
+  _cellIndexList         = std::move(cellIndexList);
+  _cells                 = std::move(cells);
+  _genomeArena           = std::move(genomeArena);
+  _actStamp              = 0;
+  _selectedCellIndex     = -1;
+  _takenCellTextureData.resize(maxCellCount);
+  setSnapshotWorld(world);
+
+  return 0;
+}
+
+int CellController::loadDeltaSnapshot(const std::uint8_t *deltaSnapshot,
+                                      size_t              deltaSnapshotSize) {
+  // Reading and checking header, world record and pseudo-random numbers generator state
+  SnapshotHeader header{};
+  SnapshotWorld  world{};
+  std::mt19937   mersenneTwisterEngine{};
+  if (readSnapshotHeader(deltaSnapshot, deltaSnapshotSize, kDeltaSnapshotMagic, header, world,
+                         mersenneTwisterEngine) != 0) {
+    return -1;
+  }
+  if (world.columns != _columns || world.rows != _rows || world.genomeSize != _genomeSize ||
+      (world.areGenesPacked != 0) != _genomeArena.isPacked()) {
+    std::cout << "error: delta snapshot does not match simulation grid or genome size"
+              << std::endl;
+    return -1;
+  }
+
+  // Getting counts of records
+  const std::size_t genomeDataSize =
+      (world.areGenesPacked != 0 ? sizeof(std::uint8_t) : sizeof(std::int32_t)) * _genomeSize;
+  const int changedCellCount = static_cast<int>(
+      header.sections[static_cast<int>(SnapshotSections::Cells)].size / sizeof(SnapshotCell));
+  const int changedGenomeCount = static_cast<int>(
+      header.sections[static_cast<int>(SnapshotSections::Genomes)].size / genomeDataSize);
+  const int clearedSlotCount = static_cast<int>(
+      header.sections[static_cast<int>(SnapshotSections::ClearedSlots)].size /
+      sizeof(std::int32_t));
+  const int cellCount = static_cast<int>(
+      header.sections[static_cast<int>(SnapshotSections::CellOrder)].size / sizeof(std::int32_t));
+  const std::uint8_t *cellData = getSnapshotSection(deltaSnapshot, header, SnapshotSections::Cells);
+  const std::uint8_t *genomeData =
+      getSnapshotSection(deltaSnapshot, header, SnapshotSections::Genomes);
+  const std::uint8_t *clearedSlotData =
+      getSnapshotSection(deltaSnapshot, header, SnapshotSections::ClearedSlots);
+  const std::uint8_t *cellOrderData =
+      getSnapshotSection(deltaSnapshot, header, SnapshotSections::CellOrder);
+
+  // Checking records against grid occupancy they lead to before anything is changed
+  const int                 maxCellCount{_columns * _rows};
+  std::vector<std::uint8_t> areOccupied{_cells.areOccupied};
+  int                       genomeCount{};
+  for (int i = 0; i < clearedSlotCount; ++i) {
+    std::int32_t index{};
+    std::memcpy(&index, clearedSlotData + sizeof(std::int32_t) * i, sizeof(std::int32_t));
+    if (index < 0 || index >= maxCellCount) {
+      std::cout << "error: delta snapshot cleared slot " << i << " is corrupted" << std::endl;
+      return -1;
+    }
+    areOccupied[index] = false;
+  }
+  int prevIndex{-1};
+  for (int i = 0; i < changedCellCount; ++i) {
+    SnapshotCell cell{};
+    std::memcpy(&cell, cellData + sizeof(SnapshotCell) * i, sizeof(SnapshotCell));
+    // Cells must go in index order and ones without genome must keep genome of occupied slot
+    const bool isOrderValid  = cell.index > prevIndex && cell.index < maxCellCount;
+    const bool isGenomeValid = cell.hasGenome != 0 ? genomeCount < changedGenomeCount
+                                                   : isOrderValid && areOccupied[cell.index];
+    if (!isOrderValid || !isGenomeValid ||
+        !isSnapshotCellValid(
+            cell, cell.hasGenome != 0 ? genomeData + genomeDataSize * genomeCount : nullptr,
+            world)) {
+      std::cout << "error: delta snapshot cell " << i << " is corrupted" << std::endl;
+      return -1;
+    }
+    areOccupied[cell.index] = true;
+    genomeCount += cell.hasGenome != 0 ? 1 : 0;
+    prevIndex = cell.index;
+  }
+  std::vector<std::uint8_t> areOrdered(maxCellCount);
+  for (int i = 0; i < cellCount; ++i) {
+    std::int32_t index{};
+    std::memcpy(&index, cellOrderData + sizeof(std::int32_t) * i, sizeof(std::int32_t));
+    if (index < 0 || index >= maxCellCount || !areOccupied[index] || areOrdered[index]) {
+      std::cout << "error: delta snapshot cell order is corrupted" << std::endl;
+      return -1;
+    }
+    areOrdered[index] = true;
+  }
+  if (genomeCount != changedGenomeCount || cellCount != world.cellCount ||
+      cellCount != std::count(areOccupied.begin(), areOccupied.end(), true)) {
+    std::cout << "error: delta snapshot does not match simulation state" << std::endl;
+    return -1;
+  }
+
+  // Releasing genomes of cleared slots and of slots whose genomes are replaced
+  for (int i = 0; i < clearedSlotCount; ++i) {
+    std::int32_t index{};
+    std::memcpy(&index, clearedSlotData + sizeof(std::int32_t) * i, sizeof(std::int32_t));
+    if (_cells.areOccupied[index]) {
+      _genomeArena.release(_cells.genomeSlots[index]);
+      _cells.areOccupied[index] = false;
+    }
+  }
+
+  // Applying changed cells and their genomes
+  for (int i = 0; i < changedCellCount; ++i) {
+    SnapshotCell cell{};
+    std::memcpy(&cell, cellData + sizeof(SnapshotCell) * i, sizeof(SnapshotCell));
+
+    int genomeSlot{_cells.genomeSlots[cell.index]};
+    if (cell.hasGenome != 0) {
+      if (!_cells.areOccupied[cell.index]) {
+        genomeSlot = _genomeArena.allocate();
+      }
+      setSnapshotGenome(_genomeArena, genomeSlot, genomeData);
+      genomeData += genomeDataSize;
+    }
+
+    setSnapshotCell(_cells, cell);
+    _cells.genomeSlots[cell.index] = genomeSlot;
+  }
+
+  // Rebuilding index list in computing order
+  _cellIndexList.clear();
+  for (int i = cellCount - 1; i >= 0; --i) {
+    std::int32_t index{};
+    std::memcpy(&index, cellOrderData + sizeof(std::int32_t) * i, sizeof(std::int32_t));
+    _cellIndexList.pushFront(index);
+  }
+
+  // Applying world record
+  _mersenneTwisterEngine = mersenneTwisterEngine;
+  if (_selectedCellIndex != -1 && !_cells.areOccupied[_selectedCellIndex]) {
+    _selectedCellIndex = -1;
+  }
+  setSnapshotWorld(world);
+
+  return 0;
+}
+
+int CellController::saveSnapshotFile(const std::string &filename) const {
+  return writeSnapshotFile(filename, saveSnapshot());
+}
+
+int CellController::loadSnapshotFile(const std::string &filename) {
+  std::vector<std::uint8_t> snapshot{};
+  if (readSnapshotFile(filename, snapshot) != 0) {
+    return -1;
+  }
+
+  return loadSnapshot(snapshot.data(), snapshot.size());
+}
+
+SnapshotParameters CellController::getParameters() const noexcept {
+  SnapshotParameters parameters{};
+
+  parameters.maxInstructionsPerTick         = _maxInstructionsPerTick;
+  parameters.maxAkinGenomDifference         = _maxAkinGenomDifference;
+  parameters.minChildEnergy                 = _minChildEnergy;
+  parameters.maxEnergy                      = _maxEnergy;
+  parameters.maxBurstOfPhotosynthesisEnergy = _maxBurstOfPhotosynthesisEnergy;
+  parameters.maxPhotosynthesisDepth         = _maxPhotosynthesisDepth;
+  parameters.summerDaytimeToWholeDayRatio   = _summerDaytimeToWholeDayRatio;
+  parameters.maxMinerals                    = _maxMinerals;
+  parameters.maxBurstOfMinerals             = _maxBurstOfMinerals;
+  parameters.energyPerMineral               = _energyPerMineral;
+  parameters.maxMineralHeight               = _maxMineralHeight;
+  parameters.maxBurstOfFoodEnergy           = _maxBurstOfFoodEnergy;
+  parameters.childBudMutationChance         = _childBudMutationChance;
+  parameters.parentBudMutationChance        = _parentBudMutationChance;
+  parameters.randomMutationChance           = _randomMutationChance;
+  parameters.dayDurationInTicks             = _dayDurationInTicks;
+  parameters.seasonDurationInDays           = _seasonDurationInDays;
+  parameters.gammaFlashPeriodInDays         = _gammaFlashPeriodInDays;
+  parameters.gammaFlashMaxMutationsCount    = _gammaFlashMaxMutationsCount;
+  for (int i = 0; i < kSnapshotEnablingFlagCount; ++i) {
+    parameters.enablingFlags |= this->*getEnablingFlagMembers()[i] ? 1u << i : 0u;
+  }
+  parameters.genomeInterpreter = static_cast<std::int32_t>(_genomeInterpreter);
+
+  return parameters;
+}
+
+int CellController::setParameters(const SnapshotParameters &parameters) {
+  if (!areSnapshotParametersValid(parameters)) {
+    std::cout << "error: simulation parameters are invalid" << std::endl;
+    return -1;
+  }
+
+  _maxInstructionsPerTick         = parameters.maxInstructionsPerTick;
+  _maxAkinGenomDifference         = parameters.maxAkinGenomDifference;
+  _minChildEnergy                 = parameters.minChildEnergy;
+  _maxEnergy                      = parameters.maxEnergy;
+  _maxBurstOfPhotosynthesisEnergy = parameters.maxBurstOfPhotosynthesisEnergy;
+  _maxPhotosynthesisDepth         = parameters.maxPhotosynthesisDepth;
+  _summerDaytimeToWholeDayRatio   = parameters.summerDaytimeToWholeDayRatio;
+  _maxMinerals                    = parameters.maxMinerals;
+  _maxBurstOfMinerals             = parameters.maxBurstOfMinerals;
+  _energyPerMineral               = parameters.energyPerMineral;
+  _maxMineralHeight               = parameters.maxMineralHeight;
+  _maxBurstOfFoodEnergy           = parameters.maxBurstOfFoodEnergy;
+  _childBudMutationChance         = parameters.childBudMutationChance;
+  _parentBudMutationChance        = parameters.parentBudMutationChance;
+  _randomMutationChance           = parameters.randomMutationChance;
+  _dayDurationInTicks             = parameters.dayDurationInTicks;
+  _seasonDurationInDays           = parameters.seasonDurationInDays;
+  _gammaFlashPeriodInDays         = parameters.gammaFlashPeriodInDays;
+  _gammaFlashMaxMutationsCount    = parameters.gammaFlashMaxMutationsCount;
+  for (int i = 0; i < kSnapshotEnablingFlagCount; ++i) {
+    this->*getEnablingFlagMembers()[i] = (parameters.enablingFlags & (1u << i)) != 0;
+  }
+  _genomeInterpreter = static_cast<GenomeInterpreters>(parameters.genomeInterpreter);
+
+  // Marking all the slots as changed for rendering as their colors depend on parameters
+  for (std::uint8_t &change : _cells.changes) {
+    change |= kSlotChangedRendering;
+  }
+
+  return 0;
+}
+
+std::uint64_t CellController::calculateStateHash() const noexcept {
+  // Hashing time, statistics counters and the next pseudo-random number
+  // (it differs if count of numbers drawn differs)
+  std::mt19937  mersenneTwisterEngine{_mersenneTwisterEngine};
+  std::uint64_t stateHash{kStateHashOffsetBasis};
+  stateHash = combineStateHash(stateHash, static_cast<std::uint64_t>(_ticksNumber));
+  stateHash = combineStateHash(stateHash, static_cast<std::uint64_t>(_yearsNumber));
+  stateHash = combineStateHash(stateHash, static_cast<std::uint64_t>(_countOfLiveCells));
+  stateHash = combineStateHash(stateHash, static_cast<std::uint64_t>(_countOfDeadCells));
+  stateHash = combineStateHash(stateHash, static_cast<std::uint64_t>(_countOfBuds));
+  stateHash =
+      combineStateHash(stateHash, static_cast<std::uint64_t>(_countOfPhotosynthesisEnergyBursts));
+  stateHash = combineStateHash(stateHash, static_cast<std::uint64_t>(_countOfMineralEnergyBursts));
+  stateHash = combineStateHash(stateHash, static_cast<std::uint64_t>(_countOfFoodEnergyBursts));
+  stateHash = combineStateHash(stateHash, mersenneTwisterEngine());
+
+  // Hashing cells with their genomes in computing order
+  const size_t genomeDataSize =
+      (_genomeArena.isPacked() ? sizeof(std::uint8_t) : sizeof(std::int32_t)) * _genomeSize;
+  IndexList::ConstIterator iter{_cellIndexList.getIterator()};
+  while (iter.hasNext()) {
+    const int index = iter.next();
+
+    // Hashing cell properties two at once
+    std::uint32_t lastEnergyShare{};
+    std::memcpy(&lastEnergyShare, &_cells.lastEnergyShares[index], sizeof(std::uint32_t));
+    std::uint64_t cellHash =
+        hashCellWord(packStateWord(index, _cells.counters[index]), 0) +
+        hashCellWord(packStateWord(_cells.energies[index], _cells.minerals[index]), 1) +
+        hashCellWord(packStateWord(_cells.directions[index], _cells.ages[index]), 2) +
+        hashCellWord(packStateWord(_cells.colorsR[index], _cells.colorsG[index]), 3) +
+        hashCellWord(packStateWord(_cells.colorsB[index], _cells.energyShareBalances[index]), 4) +
+        hashCellWord(packStateWord(lastEnergyShare,
+                                   _cells.areAlive[index] | _cells.arePinned[index] << 1u),
+                     5);
+
+    // Hashing cell genome by 64-bit words
+    const int           genomeSlot = _cells.genomeSlots[index];
+    const std::uint8_t *genomeData =
+        _genomeArena.isPacked()
+            ? _genomeArena.getPackedGenome(genomeSlot)
+            : reinterpret_cast<const std::uint8_t *>(_genomeArena.getGenome(genomeSlot));
+    size_t i = 0;
+    for (; i + sizeof(std::uint64_t) <= genomeDataSize; i += sizeof(std::uint64_t)) {
+      std::uint64_t word{};
+      std::memcpy(&word, genomeData + i, sizeof(std::uint64_t));
+      cellHash += hashCellWord(word, 6 + i / sizeof(std::uint64_t));
+    }
+    for (; i < genomeDataSize; ++i) {
+      cellHash += hashCellWord(genomeData[i], 6 + i);
+    }
+
+    stateHash = combineStateHash(stateHash, cellHash);
+  }
+
+  return stateHash;
+}
+
 int CellController::getColumns() const noexcept { return _columns; }
 
 int CellController::getRows() const noexcept { return _rows; }
 
+int CellController::getGenomeSize() const noexcept { return _genomeSize; }
+
 int CellController::getMaxPhotosynthesisDepth() const noexcept { return _maxPhotosynthesisDepth; }
 
 int CellController::getMaxMineralHeight() const noexcept { return _maxMineralHeight; }
@@ -792,23 +2249,52 @@ int CellController::getMaxMineralHeight() const noexcept { return _maxMineralHei
 bool CellController::selectCell(int column, int row) noexcept {
   int index = calculateIndexByColumnAndRow(column, row);
 
-  if (index < 0 || index >= _columns * _rows) {
-    _selectedCellPtr = nullptr;
+  // Marking previously selected slot as changed for rendering as it is not highlighted anymore
+  if (_selectedCellIndex != -1) {
+    _cells.changes[_selectedCellIndex] |= kSlotChangedRendering;
+  }
+
+  if (index < 0 || index >= _columns * _rows || !_cellIndexList.contains(index)) {
+    _selectedCellIndex = -1;
 
     return false;
   }
 
-  _selectedCellPtr = _cellPtrVector[index].get();
+  _selectedCellIndex = index;
+  _cells.changes[index] |= kSlotChangedRendering;
+
+  return true;
+}
 
-  if (_selectedCellPtr == nullptr) {
+bool CellController::getSelectedCell(Cell &cell) const {
+  // If there is no selected cell
+  if (_selectedCellIndex == -1) {
     return false;
   }
 
+  // Copying selected cell properties from cell storage columns
+  const int index          = _selectedCellIndex;
+  cell._genome.resize(_genomeSize);
+  for (int i = 0; i < _genomeSize; ++i) {
+    cell._genome[i] = _genomeArena.getGene(_cells.genomeSlots[index], i);
+  }
+  cell._counter            = _cells.counters[index];
+  cell._energy             = _cells.energies[index];
+  cell._minerals           = _cells.minerals[index];
+  cell._direction          = _cells.directions[index];
+  cell._index              = index;
+  cell._age                = _cells.ages[index];
+  cell._colorR             = _cells.colorsR[index];
+  cell._colorG             = _cells.colorsG[index];
+  cell._colorB             = _cells.colorsB[index];
+  cell._energyShareBalance = _cells.energyShareBalances[index];
+  cell._lastEnergyShare    = _cells.lastEnergyShares[index];
+  cell._isAlive            = _cells.areAlive[index];
+  cell._isPinned           = _cells.arePinned[index];
+
   return true;
 }
 
-const Cell *CellController::getSelectedCell() const noexcept { return _selectedCellPtr; }
-
 void CellController::updateTime() noexcept {
   // Updating ticks
   ++_ticksNumber;
@@ -820,131 +2306,262 @@ void CellController::updateTime() noexcept {
   }
 }
 
+void CellController::updateEnvironmentTables() noexcept {
+  // Local constants
+  static constexpr float kSeasonCount{4.0f};
+  static constexpr float kHalfOfDay{0.5f};
+
+  // Rebuilding photosynthesis energy table if its parameters have changed
+  if (_environmentTables.photosynthesisEnergies.size() != static_cast<size_t>(_rows) ||
+      _environmentTables.maxPhotosynthesisDepth != _maxPhotosynthesisDepth ||
+      _environmentTables.maxBurstOfPhotosynthesisEnergy != _maxBurstOfPhotosynthesisEnergy) {
+    _environmentTables.photosynthesisEnergies.resize(_rows);
+    for (int row = 0; row < _rows; ++row) {
+      // Calculating depth coefficient
+      float depthCoefficient = mapClamp(row, 0.0f, _maxPhotosynthesisDepth, 1.0f, 0.0f);
+
+      _environmentTables.photosynthesisEnergies[row] = static_cast<int>(
+          static_cast<float>(_maxBurstOfPhotosynthesisEnergy) * depthCoefficient);
+    }
+
+    _environmentTables.maxPhotosynthesisDepth         = _maxPhotosynthesisDepth;
+    _environmentTables.maxBurstOfPhotosynthesisEnergy = _maxBurstOfPhotosynthesisEnergy;
+  }
+
+  // Rebuilding minerals table if its parameters have changed
+  if (_environmentTables.minerals.size() != static_cast<size_t>(_rows) ||
+      _environmentTables.maxMineralHeight != _maxMineralHeight ||
+      _environmentTables.maxBurstOfMinerals != _maxBurstOfMinerals) {
+    _environmentTables.minerals.resize(_rows);
+    for (int row = 0; row < _rows; ++row) {
+      _environmentTables.minerals[row] = static_cast<int>(
+          mapClamp(row, _rows - 1, _rows - 1 - _maxMineralHeight, _maxBurstOfMinerals, 0.0f));
+    }
+
+    _environmentTables.maxMineralHeight   = _maxMineralHeight;
+    _environmentTables.maxBurstOfMinerals = _maxBurstOfMinerals;
+  }
+
+  // Rebuilding mineral energy table if its parameters have changed
+  if (_environmentTables.mineralEnergies.size() != static_cast<size_t>(_maxMinerals + 1) ||
+      _environmentTables.energyPerMineral != _energyPerMineral) {
+    _environmentTables.mineralEnergies.resize(_maxMinerals + 1);
+    for (int minerals = 0; minerals <= _maxMinerals; ++minerals) {
+      _environmentTables.mineralEnergies[minerals] =
+          static_cast<int>(static_cast<float>(minerals) * _energyPerMineral);
+    }
+
+    _environmentTables.energyPerMineral = _energyPerMineral;
+  }
+
+  // Daylight mask is not used if daytimes are disabled
+  if (!_enableDaytimes) {
+    return;
+  }
+
+  // Calculation sun epicenter position along X-axis
+  int sunPosition = static_cast<int>(
+      map(_ticksNumber % _dayDurationInTicks, 0.0f, _dayDurationInTicks - 1, 0.0f, _columns - 1));
+  // Calculation sunny area width based on current season if needed
+  float daytimeWidthRatio = 1.0f - _summerDaytimeToWholeDayRatio;
+  if (_enableSeasons) {
+    daytimeWidthRatio =
+        map(std::sin(map(_ticksNumber / _dayDurationInTicks / _seasonDurationInDays, 0.0f,
+                         kSeasonCount, 0.0f, kTwoPi)),
+            -1.0f, 1.0f, 1.0f - _summerDaytimeToWholeDayRatio, _summerDaytimeToWholeDayRatio);
+  }
+
+  // Rebuilding daylight mask if day phase has changed
+  if (_environmentTables.daylightMask.size() != static_cast<size_t>(_columns) ||
+      _environmentTables.sunPosition != sunPosition ||
+      _environmentTables.daytimeWidthRatio != daytimeWidthRatio) {
+    _environmentTables.daylightMask.resize(_columns);
+    for (int column = 0; column < _columns; ++column) {
+      // Calculation minimal or maximal distance to sun epicenter along X-axis
+      int distanceToSun = std::abs(sunPosition - column);
+      // Calculation minimal distance to sun epicenter along X-axis
+      int minDistanceToSun = std::min(distanceToSun, _columns - 1 - distanceToSun);
+
+      _environmentTables.daylightMask[column] =
+          static_cast<float>(minDistanceToSun) <
+          static_cast<float>(_columns - 1) * kHalfOfDay * daytimeWidthRatio;
+    }
+
+    _environmentTables.sunPosition       = sunPosition;
+    _environmentTables.daytimeWidthRatio = daytimeWidthRatio;
+  }
+}
+
 void CellController::gammaFlash() noexcept {
   // If the time has come
   if (_ticksNumber % _dayDurationInTicks == 0 &&
       (_ticksNumber / _dayDurationInTicks + _yearsNumber * _seasonDurationInDays * 4) %
               _gammaFlashPeriodInDays ==
           0) {
+    // Using the shared pseudo-random numbers generator
+    // or counter-based one keyed by cell index if cells are computed in parallel
+    ActContext context{RandomStream{&_mersenneTwisterEngine}};
+    RandomStream &randomStream = context.randomStream;
+
     // For each cell
-    LinkedList<int>::Iterator iter{_cellIndexList.getIterator()};
+    IndexList::Iterator iter{_cellIndexList.getIterator()};
     while (iter.hasNext()) {
-      Cell &cell = *_cellPtrVector[iter.next()];
+      const int index = iter.next();
 
       // Ignoring if cell is dead
-      if (!cell._isAlive) {
+      if (!_cells.areAlive[index]) {
         continue;
       }
 
-      int mutationsCount = std::ceil(static_cast<float>(_gammaFlashMaxMutationsCount) *
-                                     static_cast<float>(_mersenneTwisterEngine()) /
-                                     static_cast<float>(_mersenneTwisterEngine.max()));
+      // Drawing random numbers keyed by seed, time and cell index if cells are computed in parallel
+      if (_threadPool != nullptr) {
+        randomStream = RandomStream{_randomSeed, RandomStreamDomains::GammaFlash, _yearsNumber,
+                                    _ticksNumber, index};
+      }
+
+      // Generating count of mutations in range from 1 to maximal one
+      int mutationsCount = _gammaFlashMaxMutationsCount > 0
+                               ? randomStream.drawInRange(_gammaFlashMaxMutationsCount) + 1
+                               : 0;
       for (int i = 0; i < mutationsCount; ++i) {
-        mutateRandomGene(cell);
+        mutateRandomGene(index, context);
       }
     }
   }
 }
 
-void CellController::turn(Cell &cell) const noexcept {
+void CellController::turn(int index) noexcept {
   // Updating direction with overflow handling
-  int deltaDirection = getNextNthGen(cell, 1);
-  cell._direction    = (cell._direction + deltaDirection) % kDirectionCount;
+  int deltaDirection       = getNextNthGen(index, 1);
+  _cells.directions[index] = (_cells.directions[index] + deltaDirection) % kDirectionCount;
 }
 
-void CellController::move(Cell &cell) noexcept {
+int CellController::move(int index, ActContext &context) noexcept {
+  // Sampling handler if profiler is enabled
+  PROFILE_HANDLER(context, ProfiledHandlers::Move);
+
   // Calculating coordinates by target direction
   int targetDirection{};
   // If given cell is alive
-  if (cell._isAlive) {
-    int deltaDirection = getNextNthGen(cell, 1);
-    targetDirection    = (cell._direction + deltaDirection) % kDirectionCount;
+  if (_cells.areAlive[index]) {
+    int deltaDirection = getNextNthGen(index, 1);
+    targetDirection    = (_cells.directions[index] + deltaDirection) % kDirectionCount;
   }
   // If given cell is dead
   else {
     // If given cell is pinned
-    if (_enableDeadCellPinningOnSinking && cell._isPinned) {
-      return;
+    if (_enableDeadCellPinningOnSinking && _cells.arePinned[index]) {
+      return index;
     }
 
     // Setting direction to 4 so it will be moving down (sinking) each tick if cell is dead and not pinned yet
     targetDirection = 4;
   }
-  int targetIndex = calculateIndexByIndexAndDirection(cell._index, targetDirection);
+  int targetIndex = calculateIndexByIndexAndDirection(index, targetDirection);
 
   // If coordinates are beyond simulation world (above top or below bottom)
   if (targetIndex == -1) {
-    return;
+    return index;
   }
 
   // If there is nothing at this direction
-  if (_cellPtrVector[targetIndex] == nullptr) {
-    // Moving cell
+  if (!_cells.areOccupied[targetIndex]) {
+    // Moving cell index in the index list (it is rebuilt after cells are computed in parallel)
+    if (!context.isParallel) {
+      _cellIndexList.replace(index, targetIndex);
+    }
+
+    // Moving cell properties in cell storage columns
+    _cells.genomeSlots[targetIndex]         = _cells.genomeSlots[index];
+    _cells.counters[targetIndex]            = _cells.counters[index];
+    _cells.energies[targetIndex]            = _cells.energies[index];
+    _cells.minerals[targetIndex]            = _cells.minerals[index];
+    _cells.directions[targetIndex]          = _cells.directions[index];
+    _cells.ages[targetIndex]                = _cells.ages[index];
+    _cells.colorsR[targetIndex]             = _cells.colorsR[index];
+    _cells.colorsG[targetIndex]             = _cells.colorsG[index];
+    _cells.colorsB[targetIndex]             = _cells.colorsB[index];
+    _cells.energyShareBalances[targetIndex] = _cells.energyShareBalances[index];
+    _cells.lastEnergyShares[targetIndex]    = _cells.lastEnergyShares[index];
+    _cells.areAlive[targetIndex]            = _cells.areAlive[index];
+    _cells.arePinned[targetIndex]           = _cells.arePinned[index];
+    _cells.areOccupied[targetIndex]         = true;
+    _cells.actStamps[targetIndex]           = _cells.actStamps[index];
+    _cells.areOccupied[index]               = false;
+    _cells.changes[targetIndex] |=
+        kSlotChangedProperties | kSlotChangedGenome | kSlotChangedRendering;
+    _cells.changes[index] |= kSlotChangedProperties | kSlotChangedRendering;
+
+    // Making selection follow the cell
+    if (_selectedCellIndex == index) {
+      _selectedCellIndex = targetIndex;
+    }
 
-    // Order matters
-    _cellPtrVector[targetIndex] = std::move(_cellPtrVector[cell._index]);      // 1
-    _cellIndexList.replace(_cellPtrVector[targetIndex]->_index, targetIndex);  // 2
-    _cellPtrVector[targetIndex]->_index = targetIndex;                         // 3
+    return targetIndex;
   }
+
   // If there is an obstacle
+  // If given cell is dead
+  if (!_cells.areAlive[index]) {
+    // Making cell pinned
+    _cells.arePinned[index] = true;
+  }
+  // If given cell is alive
   else {
-    // If given cell is dead
-    if (!cell._isAlive) {
-      // Making cell pinned
-      cell._isPinned = true;
-    }
-    // If given cell is alive
-    else {
-      // Making cell know what has it collided with
-      touch(cell);
-      // Reverting move command counter incremention
-      --cell._counter;
-    }
+    // Making cell know what has it collided with
+    touch(index, context);
+    // Reverting move command counter incremention
+    --_cells.counters[index];
   }
+
+  return index;
 }
 
-void CellController::getEnergyFromPhotosynthesis(Cell &cell) noexcept {
+void CellController::getEnergyFromPhotosynthesis(int index, ActContext &context) noexcept {
   // Calculating energy from photosynthesis at index
-  int deltaEnergy = calculateBurstOfPhotosynthesisEnergy(cell._index);
+  int deltaEnergy = calculateBurstOfPhotosynthesisEnergy(index);
 
   // If energy from photosynthesis is positive
   if (deltaEnergy > 0) {
     // Increasing energy level
-    cell._energy += deltaEnergy;
+    _cells.energies[index] += deltaEnergy;
 
     // Making cell color more green
-    ++cell._colorG;
+    ++_cells.colorsG[index];
 
     // Updating statistics counter
-    ++_countOfPhotosynthesisEnergyBursts;
+    ++context.countOfPhotosynthesisEnergyBursts;
   }
 }
 
-void CellController::getEnergyFromMinerals(Cell &cell) noexcept {
+void CellController::getEnergyFromMinerals(int index, ActContext &context) noexcept {
   // Calculating energy from minerals at index
-  int deltaEnergy = calculateBurstOfMineralEnergy(cell._minerals);
+  int deltaEnergy = calculateBurstOfMineralEnergy(_cells.minerals[index]);
 
   // If energy from minerals is positive
   if (deltaEnergy > 0) {
     // Increasing energy level
-    cell._energy += deltaEnergy;
+    _cells.energies[index] += deltaEnergy;
 
     // Converting all the minerals
-    cell._minerals = 0;
+    _cells.minerals[index] = 0;
 
     // Making cell color more blue
-    ++cell._colorB;
+    ++_cells.colorsB[index];
 
     // Updating statistics counter
-    ++_countOfMineralEnergyBursts;
+    ++context.countOfMineralEnergyBursts;
   }
 }
 
-void CellController::getEnergyFromFood(Cell &cell) noexcept {
+void CellController::getEnergyFromFood(int index, ActContext &context) noexcept {
+  // Sampling handler if profiler is enabled
+  PROFILE_HANDLER(context, ProfiledHandlers::GetEnergyFromFood);
+
   // Calculating coordinates by index and direction
-  int deltaDirection  = getNextNthGen(cell, 1);
-  int targetDirection = (cell._direction + deltaDirection) % kDirectionCount;
-  int targetIndex     = calculateIndexByIndexAndDirection(cell._index, targetDirection);
+  int deltaDirection  = getNextNthGen(index, 1);
+  int targetDirection = (_cells.directions[index] + deltaDirection) % kDirectionCount;
+  int targetIndex     = calculateIndexByIndexAndDirection(index, targetDirection);
 
   // If coordinates are beyond simulation world (above top or below bottom)
   if (targetIndex == -1) {
@@ -952,47 +2569,47 @@ void CellController::getEnergyFromFood(Cell &cell) noexcept {
   }
 
   // If there is a live cell (prey) or organic
-  if (_cellPtrVector[targetIndex] != nullptr) {
-    // Getting cell at this direction
-    std::unique_ptr<Cell> targetCellPtr = std::move(_cellPtrVector[targetIndex]);
-
+  if (_cells.areOccupied[targetIndex]) {
     // If maximizing food energy is enabled (food energy is constant and equals to its maximum)
     if (_enableMaximizingFoodEnergy) {
       // Increasing energy level
-      cell._energy += _maxBurstOfFoodEnergy;
+      _cells.energies[index] += _maxBurstOfFoodEnergy;
     }
     // If maximizing food energy is disabled
     else {
       // Calculating energy from food
-      int deltaEnergy = std::min(targetCellPtr->_energy, _maxBurstOfFoodEnergy);
+      int deltaEnergy = std::min(_cells.energies[targetIndex], _maxBurstOfFoodEnergy);
 
       // Increasing energy level
-      cell._energy += deltaEnergy;
+      _cells.energies[index] += deltaEnergy;
     }
 
     // Making cell color more red
-    ++cell._colorR;
+    ++_cells.colorsR[index];
 
     // Updating statistics counter
-    ++_countOfFoodEnergyBursts;
+    ++context.countOfFoodEnergyBursts;
 
     // Removing prey or organic
-    removeCell(std::move(targetCellPtr));
+    removeCell(targetIndex, context);
   }
 }
 
-void CellController::bud(Cell &cell) noexcept {
+void CellController::bud(int index, ActContext &context) noexcept {
+  // Sampling handler if profiler is enabled
+  PROFILE_HANDLER(context, ProfiledHandlers::Bud);
+
   // Checking and updating energy
-  if (cell._energy < _minChildEnergy * 2) {
+  if (_cells.energies[index] < _minChildEnergy * 2) {
     return;
   }
 
   // Checking each direction clockwise for ability to bud
   for (int i = 0; i < kDirectionCount; ++i) {
     // Calculating coordinates by index and direction
-    int deltaDirection  = getNextNthGen(cell, 1);
-    int targetDirection = (cell._direction + deltaDirection + i) % kDirectionCount;
-    int targetIndex     = calculateIndexByIndexAndDirection(cell._index, targetDirection);
+    int deltaDirection  = getNextNthGen(index, 1);
+    int targetDirection = (_cells.directions[index] + deltaDirection + i) % kDirectionCount;
+    int targetIndex     = calculateIndexByIndexAndDirection(index, targetDirection);
 
     // Making sure cycle body won't repeat if trying to bud in unoccupied space is not enabled
     if (!_enableTryingToBudInUnoccupiedDirection) {
@@ -1005,41 +2622,47 @@ void CellController::bud(Cell &cell) noexcept {
     }
 
     // If there is nothing at this direction
-    if (_cellPtrVector[targetIndex] == nullptr) {
-      // Creating new cell
-      std::unique_ptr<Cell> buddedCellPtr =
-          std::make_unique<Cell>(cell._genome, cell._energy / 2, cell._direction, targetIndex);
+    if (!_cells.areOccupied[targetIndex]) {
+      // Copying parent genome (genome slots are shared by threads computing cells in parallel)
+      int genomeSlot{};
+      {
+        std::unique_lock<std::mutex> genomeArenaLock{_genomeArenaMutex, std::defer_lock};
+        if (context.isParallel) {
+          genomeArenaLock.lock();
+        }
+        genomeSlot = _genomeArena.copy(_cells.genomeSlots[index]);
+      }
+
+      // Adding budded cell
+      addCell(targetIndex, genomeSlot, _cells.energies[index] / 2, _cells.directions[index],
+              context);
 
       // Assigning cell color
-      float colorVectorLength = static_cast<float>(std::sqrt(
-          cell._colorR * cell._colorR + cell._colorG * cell._colorG + cell._colorB * cell._colorB));
-      buddedCellPtr->_colorR  = static_cast<int>(
-          static_cast<float>(cell._colorR) * kBuddedCellParentColorMultiplier / colorVectorLength);
-      buddedCellPtr->_colorG = static_cast<int>(
-          static_cast<float>(cell._colorG) * kBuddedCellParentColorMultiplier / colorVectorLength);
-      buddedCellPtr->_colorB = static_cast<int>(
-          static_cast<float>(cell._colorB) * kBuddedCellParentColorMultiplier / colorVectorLength);
+      const int colorR            = _cells.colorsR[index];
+      const int colorG            = _cells.colorsG[index];
+      const int colorB            = _cells.colorsB[index];
+      float     colorVectorLength = static_cast<float>(
+          std::sqrt(colorR * colorR + colorG * colorG + colorB * colorB));
+      _cells.colorsR[targetIndex] = static_cast<int>(
+          static_cast<float>(colorR) * kBuddedCellParentColorMultiplier / colorVectorLength);
+      _cells.colorsG[targetIndex] = static_cast<int>(
+          static_cast<float>(colorG) * kBuddedCellParentColorMultiplier / colorVectorLength);
+      _cells.colorsB[targetIndex] = static_cast<int>(
+          static_cast<float>(colorB) * kBuddedCellParentColorMultiplier / colorVectorLength);
 
       // Applying random bud mutation to the budded cell
-      if (static_cast<float>(_mersenneTwisterEngine()) /
-              static_cast<float>(_mersenneTwisterEngine.max()) <
-          _childBudMutationChance) {
-        mutateRandomGene(*buddedCellPtr);
+      if (context.randomStream.drawWithProbability(_childBudMutationChance)) {
+        mutateRandomGene(targetIndex, context);
       }
 
       // Applying random bud mutation to current cell
-      cell._energy -= cell._energy / 2;
-      if (static_cast<float>(_mersenneTwisterEngine()) /
-              static_cast<float>(_mersenneTwisterEngine.max()) <
-          _parentBudMutationChance) {
-        mutateRandomGene(cell);
+      _cells.energies[index] -= _cells.energies[index] / 2;
+      if (context.randomStream.drawWithProbability(_parentBudMutationChance)) {
+        mutateRandomGene(index, context);
       }
 
       // Updating statistics counter
-      ++_countOfBuds;
-
-      // Adding budded cell
-      addCell(std::move(buddedCellPtr));
+      ++context.countOfBuds;
 
       return;
     }
@@ -1047,25 +2670,25 @@ void CellController::bud(Cell &cell) noexcept {
 
   // Turning cell into organic if it have to bud but not able to do it
   if (_enableDeathOnBuddingIfNotEnoughSpace) {
-    cell._isAlive = false;
+    _cells.areAlive[index] = false;
   }
 }
 
-void CellController::mutateRandomGene(Cell &cell) noexcept {
+void CellController::mutateRandomGene(int index, ActContext &context) noexcept {
+  // Generating new gene value before its position (keeps the order of random numbers)
+  const int gene     = context.randomStream.drawInRange(_genomeSize);
+  const int position = context.randomStream.drawInRange(_genomeSize);
+
   // Changing random gene on another random one
-  cell._genome[std::floor(static_cast<float>(_mersenneTwisterEngine()) /
-                          static_cast<float>(_mersenneTwisterEngine.max()) *
-                          static_cast<float>(_genomeSize))] =
-      std::floor(static_cast<float>(_mersenneTwisterEngine()) /
-                 static_cast<float>(_mersenneTwisterEngine.max()) *
-                 static_cast<float>(_genomeSize));
+  _genomeArena.setGene(_cells.genomeSlots[index], position, gene);
+  _cells.changes[index] |= kSlotChangedGenome;
 }
 
-void CellController::shareEnergy(Cell &cell) const noexcept {
+void CellController::shareEnergy(int index) noexcept {
   // Calculating coordinates by index and direction
-  int deltaDirection  = getNextNthGen(cell, 1);
-  int targetDirection = (cell._direction + deltaDirection) % kDirectionCount;
-  int targetIndex     = calculateIndexByIndexAndDirection(cell._index, targetDirection);
+  int deltaDirection  = getNextNthGen(index, 1);
+  int targetDirection = (_cells.directions[index] + deltaDirection) % kDirectionCount;
+  int targetIndex     = calculateIndexByIndexAndDirection(index, targetDirection);
 
   // If coordinates are beyond simulation world (above top or below bottom)
   if (targetIndex == -1) {
@@ -1073,33 +2696,35 @@ void CellController::shareEnergy(Cell &cell) const noexcept {
   }
 
   // If there is a cell
-  if (_cellPtrVector[targetIndex] != nullptr && _cellPtrVector[targetIndex]->_isAlive) {
-    // Getting cell at this direction
-    Cell &targetCell = *_cellPtrVector[targetIndex];
-
+  if (_cells.areOccupied[targetIndex] && _cells.areAlive[targetIndex]) {
     // Calculating energy to share
-    int deltaEnergy = static_cast<int>(static_cast<float>(cell._energy * getNextNthGen(cell, 2)) /
-                                       static_cast<float>(_genomeSize));
+    int deltaEnergy =
+        static_cast<int>(static_cast<float>(_cells.energies[index] * getNextNthGen(index, 2)) /
+                         static_cast<float>(_genomeSize));
 
     // Sharing energy
-    cell._energy -= deltaEnergy;
-    targetCell._energy += deltaEnergy;
+    _cells.energies[index] -= deltaEnergy;
+    _cells.energies[targetIndex] += deltaEnergy;
 
     // Updating energy share balances
-    cell._energyShareBalance += deltaEnergy;
-    targetCell._energyShareBalance -= deltaEnergy;
+    _cells.energyShareBalances[index] += deltaEnergy;
+    _cells.energyShareBalances[targetIndex] -= deltaEnergy;
 
     // Updating last energy shares
-    cell._lastEnergyShare       = 1.0f;
-    targetCell._lastEnergyShare = -1.0f;
+    _cells.lastEnergyShares[index]       = 1.0f;
+    _cells.lastEnergyShares[targetIndex] = -1.0f;
+    _cells.changes[targetIndex] |= kSlotChangedProperties | kSlotChangedRendering;
   }
 }
 
-void CellController::touch(Cell &cell) const noexcept {
+void CellController::touch(int index, ActContext &context) noexcept {
+  // Sampling handler if profiler is enabled
+  PROFILE_HANDLER(context, ProfiledHandlers::Touch);
+
   // Calculating coordinates by index and direction
-  int deltaDirection  = getNextNthGen(cell, 1);
-  int targetDirection = (cell._direction + deltaDirection) % kDirectionCount;
-  int targetIndex     = calculateIndexByIndexAndDirection(cell._index, targetDirection);
+  int deltaDirection  = getNextNthGen(index, 1);
+  int targetDirection = (_cells.directions[index] + deltaDirection) % kDirectionCount;
+  int targetIndex     = calculateIndexByIndexAndDirection(index, targetDirection);
 
   // If coordinates are beyond simulation world (above top or below bottom)
   if (targetIndex == -1) {
@@ -1107,214 +2732,308 @@ void CellController::touch(Cell &cell) const noexcept {
   }
 
   // If there is a live cell (prey) or organic
-  if (_cellPtrVector[targetIndex] != nullptr) {
-    // Getting cell at this direction
-    const Cell &targetCell = *_cellPtrVector[targetIndex];
-
+  if (_cells.areOccupied[targetIndex]) {
     // If it is a live cell
-    if (targetCell._isAlive) {
+    if (_cells.areAlive[targetIndex]) {
       // If it is an akin cell
-      if (areAkin(cell, targetCell)) {
-        jumpCounter(cell, getNextNthGen(cell, 4));
+      if (areAkin(index, targetIndex)) {
+        jumpCounter(index, getNextNthGen(index, 4));
       }
       // If it is a strange cell
       else {
-        jumpCounter(cell, getNextNthGen(cell, 5));
+        jumpCounter(index, getNextNthGen(index, 5));
       }
     }
     // If it is food
     else {
-      jumpCounter(cell, getNextNthGen(cell, 3));
+      jumpCounter(index, getNextNthGen(index, 3));
     }
   }
   // If there is nothing at this direction
   else {
-    jumpCounter(cell, getNextNthGen(cell, 2));
+    jumpCounter(index, getNextNthGen(index, 2));
   }
 }
 
-void CellController::determineEnergyLevel(Cell &cell) const noexcept {
+void CellController::determineEnergyLevel(int index) noexcept {
   // Calculating value to compare
-  int valueToCompare = static_cast<int>(static_cast<float>(_maxEnergy * getNextNthGen(cell, 1)) /
+  int valueToCompare = static_cast<int>(static_cast<float>(_maxEnergy * getNextNthGen(index, 1)) /
                                         static_cast<float>(_genomeSize));
 
   // Less
-  if (cell._energy < valueToCompare) {
-    jumpCounter(cell, getNextNthGen(cell, 2));
+  if (_cells.energies[index] < valueToCompare) {
+    jumpCounter(index, getNextNthGen(index, 2));
   }
   // Greater or equal
   else {
-    jumpCounter(cell, getNextNthGen(cell, 3));
+    jumpCounter(index, getNextNthGen(index, 3));
   }
 }
 
-void CellController::determineDepth(Cell &cell) const noexcept {
+void CellController::determineDepth(int index) noexcept {
   // Calculating values to compare
-  int row            = calculateRowByIndex(cell._index);
-  int valueToCompare = static_cast<int>(static_cast<float>(_rows * getNextNthGen(cell, 1)) /
+  int row            = calculateRowByIndex(index);
+  int valueToCompare = static_cast<int>(static_cast<float>(_rows * getNextNthGen(index, 1)) /
                                         static_cast<float>(_genomeSize));
 
   // Less
   if (row < valueToCompare) {
-    jumpCounter(cell, getNextNthGen(cell, 2));
+    jumpCounter(index, getNextNthGen(index, 2));
   }
   // Greater or equal
   else {
-    jumpCounter(cell, getNextNthGen(cell, 3));
+    jumpCounter(index, getNextNthGen(index, 3));
   }
 }
 
-void CellController::determineBurstOfPhotosynthesisEnergy(Cell &cell) const noexcept {
+void CellController::determineBurstOfPhotosynthesisEnergy(int index) noexcept {
   // Calculating value to compare
   int valueToCompare = static_cast<int>(
-      static_cast<float>(_maxBurstOfPhotosynthesisEnergy * getNextNthGen(cell, 1)) /
+      static_cast<float>(_maxBurstOfPhotosynthesisEnergy * getNextNthGen(index, 1)) /
       static_cast<float>(_genomeSize));
 
   // Calculating available photosynthesis energy
-  int deltaEnergy = calculateBurstOfPhotosynthesisEnergy(cell._index);
+  int deltaEnergy = calculateBurstOfPhotosynthesisEnergy(index);
 
   // Less
   if (deltaEnergy < valueToCompare) {
-    jumpCounter(cell, getNextNthGen(cell, 2));
+    jumpCounter(index, getNextNthGen(index, 2));
   }
   // Greater or equal
   else {
-    jumpCounter(cell, getNextNthGen(cell, 3));
+    jumpCounter(index, getNextNthGen(index, 3));
   }
 }
 
-void CellController::determineBurstOfMinerals(Cell &cell) const noexcept {
+void CellController::determineBurstOfMinerals(int index) noexcept {
   // Calculating value to compare
   int valueToCompare =
-      static_cast<int>(static_cast<float>(_maxBurstOfMinerals * getNextNthGen(cell, 1)) /
+      static_cast<int>(static_cast<float>(_maxBurstOfMinerals * getNextNthGen(index, 1)) /
                        static_cast<float>(_genomeSize));
 
   // Calculating available minerals
-  int deltaMinerals = calculateBurstOfMinerals(cell._index);
+  int deltaMinerals = calculateBurstOfMinerals(index);
 
   // Less
   if (deltaMinerals < valueToCompare) {
-    jumpCounter(cell, getNextNthGen(cell, 2));
+    jumpCounter(index, getNextNthGen(index, 2));
   }
   // Greater or equal
   else {
-    jumpCounter(cell, getNextNthGen(cell, 3));
+    jumpCounter(index, getNextNthGen(index, 3));
   }
 }
 
-void CellController::determineBurstOfMineralEnergy(Cell &cell) const noexcept {
+void CellController::determineBurstOfMineralEnergy(int index) noexcept {
   // Calculating value to compare
   int valueToCompare = static_cast<int>(_energyPerMineral * static_cast<float>(_maxMinerals) *
-                                        static_cast<float>(getNextNthGen(cell, 1)) /
+                                        static_cast<float>(getNextNthGen(index, 1)) /
                                         static_cast<float>(_genomeSize));
 
   // Calculating available mineral energy
-  int deltaEnergy = calculateBurstOfMineralEnergy(cell._minerals);
+  int deltaEnergy = calculateBurstOfMineralEnergy(_cells.minerals[index]);
 
   // Less
   if (deltaEnergy < valueToCompare) {
-    jumpCounter(cell, getNextNthGen(cell, 2));
+    jumpCounter(index, getNextNthGen(index, 2));
   }
   // Greater or equal
   else {
-    jumpCounter(cell, getNextNthGen(cell, 3));
+    jumpCounter(index, getNextNthGen(index, 3));
   }
 }
 
-void CellController::incrementGenomCounter(Cell &cell) const noexcept {
-  // Incrementing instruction counter with overflow handling
-  cell._counter = (cell._counter + 1) % _genomeSize;
+void CellController::incrementGenomCounter(int index) noexcept {
+  // Incrementing instruction counter with overflow handling (counter is always in genome bounds)
+  int &counter = _cells.counters[index];
+  if (++counter == _genomeSize) {
+    counter = 0;
+  }
 }
 
-void CellController::addGenToCounter(Cell &cell) const noexcept {
+void CellController::addGenToCounter(int index) noexcept {
   // Adding dummy instruction value to instruction counter with overflow handling
-  cell._counter = (cell._counter + cell._genome[cell._counter]) % _genomeSize;
+  _cells.counters[index] =
+      (_cells.counters[index] +
+       _genomeArena.getGene(_cells.genomeSlots[index], _cells.counters[index])) %
+      _genomeSize;
 }
 
-void CellController::jumpCounter(Cell &cell, int offset) const noexcept {
+void CellController::jumpCounter(int index, int offset) noexcept {
   // Performing jump command on instruction counter with overflow handling
-  cell._counter = (cell._counter + offset) % _genomeSize;
+  _cells.counters[index] = (_cells.counters[index] + offset) % _genomeSize;
 }
 
-int CellController::getNextNthGen(const Cell &cell, int n) const noexcept {
+int CellController::getNextNthGen(int index, int n) const noexcept {
   // Getting (counter + n)'th gene
-  return cell._genome[(cell._counter + n) % _genomeSize];
+  return _genomeArena.getGene(_cells.genomeSlots[index],
+                              (_cells.counters[index] + n) % _genomeSize);
 }
 
-bool CellController::areAkin(const Cell &cell1, const Cell &cell2) const noexcept {
-  int diff{};
+bool CellController::areAkin(int index1, int index2) const noexcept {
+  const int genomeSlot1 = _cells.genomeSlots[index1];
+  const int genomeSlot2 = _cells.genomeSlots[index2];
 
-  for (int i = 0; i < _genomeSize; ++i) {
-    if (cell1._genome[i] != cell2._genome[i]) {
-      ++diff;
-      if (diff > _maxAkinGenomDifference) {
-        return false;
-      }
-    }
+  // Comparing genomes in the form they are stored in
+  if (_genomeArena.isPacked()) {
+    return arePackedGenomesAkin(_genomeArena.getPackedGenome(genomeSlot1),
+                                _genomeArena.getPackedGenome(genomeSlot2), _genomeSize,
+                                _maxAkinGenomDifference);
   }
-
-  return true;
+  return areGenomesAkin(_genomeArena.getGenome(genomeSlot1), _genomeArena.getGenome(genomeSlot2),
+                        _genomeSize, _maxAkinGenomDifference);
 }
 
 int CellController::calculateBurstOfPhotosynthesisEnergy(int index) const noexcept {
-  // Local constants
-  static constexpr float kSeasonCount{4.0f};
-  static constexpr float kHalfOfDay{0.5f};
-
-  // Calculating cell column and row
-  int column = calculateColumnByIndex(index);
-  int row    = calculateRowByIndex(index);
-
-  // Calculating daytime coefficient if needed
-  float daytimeCoefficient = 1.0f;
-  if (_enableDaytimes) {
-    // Calculation sun epicenter position along X-axis
-    int sunPosition = static_cast<int>(
-        map(_ticksNumber % _dayDurationInTicks, 0.0f, _dayDurationInTicks - 1, 0.0f, _columns - 1));
-    // Calculation minimal or maximal distance to sun epicenter along X-axis
-    int distanceToSun = std::abs(sunPosition - column);
-    // Calculation minimal distance to sun epicenter along X-axis
-    int minDistanceToSun = std::min(distanceToSun, _columns - 1 - distanceToSun);
-    // Calculation sunny area width based on current season if needed
-    float daytimeWidthRatio = 1.0f - _summerDaytimeToWholeDayRatio;
-    if (_enableSeasons) {
-      daytimeWidthRatio =
-          map(std::sin(map(_ticksNumber / _dayDurationInTicks / _seasonDurationInDays, 0.0f,
-                           kSeasonCount, 0.0f, kTwoPi)),
-              -1.0f, 1.0f, 1.0f - _summerDaytimeToWholeDayRatio, _summerDaytimeToWholeDayRatio);
-    }
-    // Calculating daytime coefficient
-    daytimeCoefficient = (static_cast<float>(minDistanceToSun) <
-                          static_cast<float>(_columns - 1) * kHalfOfDay * daytimeWidthRatio)
-                             ? 1.0f
-                             : 0.0f;
-
-    // If it is night here
-    if (daytimeCoefficient < 1.0f) {
-      return 0;
-    }
+  // If it is night here
+  if (_enableDaytimes && !_environmentTables.daylightMask[calculateColumnByIndex(index)]) {
+    return 0;
   }
 
-  // Calculating depth coefficient
-  float depthCoefficient = mapClamp(row, 0.0f, _maxPhotosynthesisDepth, 1.0f, 0.0f);
-
-  // Getting energy from photosynthesis
-  return static_cast<int>((static_cast<float>(_maxBurstOfPhotosynthesisEnergy) * depthCoefficient *
-                           daytimeCoefficient));
+  // Getting energy from photosynthesis at row
+  return _environmentTables.photosynthesisEnergies[calculateRowByIndex(index)];
 }
 
 int CellController::calculateBurstOfMinerals(int index) const noexcept {
-  // Calculating cell row
-  int row = calculateRowByIndex(index);
-
-  // Getting minerals
-  return static_cast<int>(
-      mapClamp(row, _rows - 1, _rows - 1 - _maxMineralHeight, _maxBurstOfMinerals, 0.0f));
+  // Getting minerals at row
+  return _environmentTables.minerals[calculateRowByIndex(index)];
 }
 
 int CellController::calculateBurstOfMineralEnergy(int minerals) const noexcept {
+  // Calculating energy directly if cell has more minerals than table covers
+  // (possible for a tick after maximal minerals count has been decreased)
+  if (minerals >= static_cast<int>(_environmentTables.mineralEnergies.size())) {
+    return static_cast<int>(static_cast<float>(minerals) * _energyPerMineral);
+  }
+
   // Getting energy from minerals
-  return static_cast<int>(static_cast<float>(minerals) * _energyPerMineral);
+  return _environmentTables.mineralEnergies[minerals];
+}
+
+void CellController::calculateCellColor(int index, int cellRenderingMode, float &colorR,
+                                        float &colorG, float &colorB) const noexcept {
+  // Local constants
+  static constexpr float kMinColor{0.0f};
+  static constexpr float kHalfColor{0.5f};
+  static constexpr float kThreeQuartersColor{0.75f};
+  static constexpr float kMaxColor{1.0f};
+
+  // If cell is selected
+  if (_selectedCellIndex == index) {
+    colorR = kMinColor;
+    colorG = kMinColor;
+    colorB = kMinColor;
+  }
+  // Else if cell is alive
+  else if (_cells.areAlive[index]) {
+    // Choosing appropriate cell rendering mode
+    switch (static_cast<CellRenderingModes>(cellRenderingMode)) {
+      // Diet mode
+      case CellRenderingModes::Diet: {
+        // Normalizing color and reducing it to range from 0 to 255
+        colorR = static_cast<float>(_cells.colorsR[index]);
+        colorG = static_cast<float>(_cells.colorsG[index]);
+        colorB = static_cast<float>(_cells.colorsB[index]);
+
+        float colorVectorLength = std::sqrt(colorR * colorR + colorG * colorG + colorB * colorB);
+
+        if (colorVectorLength < 1.0f) {
+          colorR = kMinColor;
+          colorG = kMinColor;
+          colorB = kMinColor;
+        } else {
+          colorR /= colorVectorLength;
+          colorG /= colorVectorLength;
+          colorB /= colorVectorLength;
+        }
+      } break;
+      // Energy level mode
+      case CellRenderingModes::EnergyLevel: {
+        colorR = kMaxColor;
+        colorG = map(_cells.energies[index], 0.0f, _maxEnergy, kMaxColor, kMinColor);
+        colorB = kMinColor;
+      } break;
+      // Energy sharing balance mode
+      case CellRenderingModes::EnergySharingBalance: {
+        const int energyShareBalance = _cells.energyShareBalances[index];
+
+        colorR = mapClamp(energyShareBalance, -_maxEnergy, _maxEnergy, kMaxColor, kMinColor);
+        colorG = mapClamp(energyShareBalance, -_maxEnergy, _maxEnergy, kHalfColor, kMaxColor);
+        colorB = mapClamp(energyShareBalance, -_maxEnergy, _maxEnergy, kMinColor, kMaxColor);
+      } break;
+      // Last energy share mode
+      case CellRenderingModes::LastEnergyShare: {
+        const float lastEnergyShare = _cells.lastEnergyShares[index];
+
+        colorR = map(lastEnergyShare, -1.0f, 1.0f, kMaxColor, kMinColor);
+        colorG = map(lastEnergyShare, -1.0f, 1.0f, kHalfColor, kMaxColor);
+        colorB = map(lastEnergyShare, -1.0f, 1.0f, kMinColor, kMaxColor);
+      } break;
+      // Age mode
+      case CellRenderingModes::Age: {
+        colorR = mapClamp(_cells.ages[index], 0.0f, kMaxRenderedAge, kMinColor, kMaxColor);
+        colorG = mapClamp(_cells.ages[index], 0.0f, kMaxRenderedAge, kMaxColor, kMinColor);
+        colorB = mapClamp(_cells.ages[index], 0.0f, kMaxRenderedAge, kMaxColor, kMinColor);
+      } break;
+    }
+  }
+  // Else if cell is dead
+  else {
+    colorR = kThreeQuartersColor;
+    colorG = kThreeQuartersColor;
+    colorB = kThreeQuartersColor;
+  }
+}
+
+CellController::CellTextureData CellController::calculateCellTextureData(
+    int index) const noexcept {
+  // Local constants
+  static constexpr float kMaxAttribute{255.0f};
+  static constexpr float kRoundingOffset{0.5f};
+
+  // Clearing attributes if there is no cell
+  CellTextureData data{};
+  if (!_cellIndexList.contains(index)) {
+    return data;
+  }
+
+  // Setting only state of slot if cell is not rendered by its attributes
+  // (so dead and selected cells do not change texture while they age)
+  if (_selectedCellIndex == index) {
+    data.state = static_cast<std::uint8_t>(CellTextureStates::Selected);
+    return data;
+  }
+  if (!_cells.areAlive[index]) {
+    data.state = static_cast<std::uint8_t>(CellTextureStates::Dead);
+    return data;
+  }
+  data.state = static_cast<std::uint8_t>(CellTextureStates::Alive);
+
+  // Scaling diet color so its greatest component is the maximal one
+  // (shader normalizes it as color vector direction is only rendered)
+  const int maxDietColor{
+      std::max({_cells.colorsR[index], _cells.colorsG[index], _cells.colorsB[index], 0})};
+  const float dietColorScale{maxDietColor > 0 ? kMaxAttribute / maxDietColor : 0.0f};
+  data.dietColorR = static_cast<std::uint8_t>(std::max(_cells.colorsR[index], 0) * dietColorScale +
+                                              kRoundingOffset);
+  data.dietColorG = static_cast<std::uint8_t>(std::max(_cells.colorsG[index], 0) * dietColorScale +
+                                              kRoundingOffset);
+  data.dietColorB = static_cast<std::uint8_t>(std::max(_cells.colorsB[index], 0) * dietColorScale +
+                                              kRoundingOffset);
+
+  // Normalizing attributes used by the other cell rendering modes
+  data.energy = static_cast<std::uint8_t>(
+      mapClamp(_cells.energies[index], 0.0f, _maxEnergy, 0.0f, kMaxAttribute) + kRoundingOffset);
+  data.energyShareBalance = static_cast<std::uint8_t>(
+      mapClamp(_cells.energyShareBalances[index], -_maxEnergy, _maxEnergy, 0.0f, kMaxAttribute) +
+      kRoundingOffset);
+  data.lastEnergyShare = static_cast<std::uint8_t>(
+      mapClamp(_cells.lastEnergyShares[index], -1.0f, 1.0f, 0.0f, kMaxAttribute) +
+      kRoundingOffset);
+  data.age = static_cast<std::uint8_t>(
+      mapClamp(_cells.ages[index], 0.0f, kMaxRenderedAge, 0.0f, kMaxAttribute) + kRoundingOffset);
+
+  return data;
 }
 
 int CellController::calculateColumnByIndex(int index) const noexcept {
@@ -1342,23 +3061,56 @@ int CellController::calculateIndexByIndexAndDirection(int index, int direction)
   return calculateIndexByColumnAndRow(c, r);
 }
 
-void CellController::addCell(std::unique_ptr<Cell> cellPtr) noexcept {
-  // Pushing cell to the front of the linked list
+void CellController::addCell(int index, int genomeSlot, int energy, int direction,
+                             ActContext &context) noexcept {
+  // Pushing cell index to the front of the index list
   // so it will be processed not earlier than the next tick
   // and before older cells (younger cells have smaller "reaction time")
+  // (index list is rebuilt after cells are computed in parallel)
+  if (!context.isParallel) {
+    _cellIndexList.pushFront(index);
+  }
 
-  // Order matters
-  _cellIndexList.pushFront(cellPtr->_index);             // 1
-  _cellPtrVector[cellPtr->_index] = std::move(cellPtr);  // 2
+  // Initializing cell properties in cell storage columns
+  _cells.genomeSlots[index]         = genomeSlot;
+  _cells.counters[index]            = 0;
+  _cells.energies[index]            = energy;
+  _cells.minerals[index]            = 0;
+  _cells.directions[index]          = direction;
+  _cells.ages[index]                = 0;
+  _cells.colorsR[index]             = 0;
+  _cells.colorsG[index]             = 0;
+  _cells.colorsB[index]             = 0;
+  _cells.energyShareBalances[index] = 0;
+  _cells.lastEnergyShares[index]    = 0.0f;
+  _cells.areAlive[index]            = true;
+  _cells.arePinned[index]           = false;
+  _cells.areOccupied[index]         = true;
+  // Making cell not computed in parallel until the next tick
+  _cells.actStamps[index] = _actStamp;
+  // Marking slot as changed for delta snapshots and rendering
+  _cells.changes[index] |= kSlotChangedProperties | kSlotChangedGenome | kSlotChangedRendering;
 }
 
-void CellController::removeCell(std::unique_ptr<Cell> cellPtr) noexcept {
+void CellController::removeCell(int index, ActContext &context) noexcept {
   // Unselect cell if it is selected
-  if (cellPtr.get() == _selectedCellPtr) {
-    _selectedCellPtr = nullptr;
+  if (index == _selectedCellIndex) {
+    _selectedCellIndex = -1;
   }
 
-  // Order matters
-  _cellIndexList.remove(cellPtr->_index);     // 1
-  _cellPtrVector[cellPtr->_index] = nullptr;  // 2
+  // Removing cell index from the index list (its columns are reused by the next cell at index)
+  // (index list is rebuilt after cells are computed in parallel)
+  if (!context.isParallel) {
+    _cellIndexList.remove(index);
+  }
+  _cells.areOccupied[index] = false;
+  _cells.changes[index] |= kSlotChangedProperties | kSlotChangedRendering;
+
+  // Releasing cell genome slot for reuse by budded cells
+  // (genome slots are shared by threads computing cells in parallel)
+  std::unique_lock<std::mutex> genomeArenaLock{_genomeArenaMutex, std::defer_lock};
+  if (context.isParallel) {
+    genomeArenaLock.lock();
+  }
+  _genomeArena.release(_cells.genomeSlots[index]);
 }
@@ -8,15 +8,28 @@
 #define CELL_CONTROLLER_HPP
 
 // STD
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <random>
+#include <string>
 #include <vector>
 
-// "LinkedList" internal library
-#include <linked_list/linked_list.hpp>
+// "IndexList" internal library
+#include <index_list/index_list.hpp>
+// "ThreadPool" internal library
+#include <thread_pool/thread_pool.hpp>
 
 // "cell" internal header
 #include "./cell.hpp"
+// "genome_arena" internal header
+#include "./genome_arena.hpp"
+// "random_stream" internal header
+#include "./random_stream.hpp"
+// "snapshot" internal header
+#include "./snapshot.hpp"
 
 namespace cellarium {
 
@@ -108,6 +121,46 @@ enum class CellRenderingModes {
   Size
 };
 
+// Cell texture slot state enumeration (shader picks color of slot by it)
+enum class CellTextureStates {
+  Empty,
+  Dead,
+  Alive,
+  Selected,
+  Size
+};
+
+// Genome interpreter enumeration
+enum class GenomeInterpreters {
+  // Switch over instructions in a loop
+  Switch,
+  // Computed goto (direct threaded code) where supported by compiler, switch otherwise
+  Threaded,
+  Size
+};
+
+// Initial value of CellController::Params::genomeInterpreter field
+static constexpr GenomeInterpreters kInitGenomeInterpreter = GenomeInterpreters::Threaded;
+
+// Initial values of CellController::Params parallel tick fields
+// (zero thread count means sequential computing of cells, zero tile height means column stripes)
+static constexpr int kInitThreadCount = 0;
+static constexpr int kInitTileWidth   = 8;
+static constexpr int kInitTileHeight  = 8;
+
+// Count of instructions counted by profiler (unconditional jumps are counted as the last one)
+// (profiler is enabled by defining CELLARIUM_PROFILING at compile time)
+static constexpr int kProfiledInstructionCount = static_cast<int>(CellInstructions::Size) + 1;
+
+// Instruction handlers whose cycles are sampled by profiler
+enum class ProfiledHandlers {
+  Move,
+  GetEnergyFromFood,
+  Bud,
+  Touch,
+  Size
+};
+
 // Class for stroring simulation parameters and state, computing it and filling data for rendering
 class CellController {
  public:
@@ -172,6 +225,12 @@ class CellController {
     float            firstCellEnergyMultiplier{kInitFirstCellEnergyMultiplier};
     int              firstCellDirection{kInitFirstCellDirection};
     float            firstCellIndexMultiplier{kInitFirstCellIndexMultiplier};
+
+    GenomeInterpreters genomeInterpreter{kInitGenomeInterpreter};
+
+    int threadCount{kInitThreadCount};
+    int tileWidth{kInitTileWidth};
+    int tileHeight{kInitTileHeight};
   };
 
   // Struct for storing index and color for rendering cell
@@ -183,6 +242,33 @@ class CellController {
     float colorB{};
   };
 
+  // Struct for storing attributes of slot normalized to range from 0 to 255 for rendering
+  // it to texture (shader computes color of slot from them in any cell rendering mode)
+  struct CellTextureData {
+    // Diet color scaled so its greatest component is 255 and state of slot (CellTextureStates)
+    std::uint8_t dietColorR{};
+    std::uint8_t dietColorG{};
+    std::uint8_t dietColorB{};
+    std::uint8_t state{};
+
+    std::uint8_t energy{};
+    std::uint8_t energyShareBalance{};
+    std::uint8_t lastEnergyShare{};
+    std::uint8_t age{};
+  };
+
+  // Struct for storing execution profile counters
+  struct Profile {
+    // Counts of executed instructions and of instructions reaching instructions per tick limit
+    std::array<long, kProfiledInstructionCount> instructionCounts{};
+    std::array<long, kProfiledInstructionCount> instructionLimitCounts{};
+
+    // Counts of handler calls and of sampled ones with cycles spent in them
+    std::array<long, static_cast<int>(ProfiledHandlers::Size)>          handlerCallCounts{};
+    std::array<long, static_cast<int>(ProfiledHandlers::Size)>          handlerSampleCounts{};
+    std::array<std::uint64_t, static_cast<int>(ProfiledHandlers::Size)> handlerSampleCycles{};
+  };
+
   // Struct for storing simulation statistics
   struct Statistics {
     int tick{};
@@ -200,6 +286,28 @@ class CellController {
     long countOfPhotosynthesisEnergyBursts{};
     long countOfMineralEnergyBursts{};
     long countOfFoodEnergyBursts{};
+
+#ifdef CELLARIUM_PROFILING
+    Profile profile{};
+#endif
+  };
+
+  // Struct for read-only access to cell property columns indexed by cell index
+  // (pointers stay valid until CellController is assigned, destroyed or loads snapshot
+  // as it replaces the columns, so view must be got again after that)
+  struct CellGridView {
+    int columns{};
+    int rows{};
+
+    const std::uint8_t *areOccupied{};
+    const std::uint8_t *areAlive{};
+    const int          *energies{};
+    const int          *minerals{};
+    const int          *directions{};
+    const int          *ages{};
+    const int          *colorsR{};
+    const int          *colorsG{};
+    const int          *colorsB{};
   };
 
  private:
@@ -259,10 +367,103 @@ class CellController {
   bool _enableMaximizingFoodEnergy{};
   bool _enableDeadCellPinningOnSinking{};
 
-  // Linked list of cell indices for quick consequent access
-  LinkedList<int> _cellIndexList{};
-  // Vector of cells for quick random access
-  std::vector<std::unique_ptr<Cell>> _cellPtrVector{};
+  // Genome interpreter used in act()
+  GenomeInterpreters _genomeInterpreter{};
+
+  // Parallel tick properties (tiles of the same color are computed at once by thread pool)
+  int _threadCount{};
+  int _tileWidth{};
+  int _tileHeight{};
+
+  // Pointer to act() specialization
+  using ActFunction = void (CellController::*)() noexcept;
+
+  // Enabling flags bitset and act() specialization picked for it
+  std::uint32_t _actFlags{};
+  ActFunction   _actFunction{};
+
+  // Struct for storing cell properties in columns indexed by cell index (struct of arrays)
+  struct CellStorage {
+    std::vector<int>           genomeSlots{};
+    std::vector<int>           counters{};
+    std::vector<int>           energies{};
+    std::vector<int>           minerals{};
+    std::vector<int>           directions{};
+    std::vector<int>           ages{};
+    std::vector<int>           colorsR{};
+    std::vector<int>           colorsG{};
+    std::vector<int>           colorsB{};
+    std::vector<int>           energyShareBalances{};
+    std::vector<float>         lastEnergyShares{};
+    std::vector<std::uint8_t>  areAlive{};
+    std::vector<std::uint8_t>  arePinned{};
+    std::vector<std::uint8_t>  areOccupied{};
+    std::vector<std::uint32_t> actStamps{};
+    // Grid slot change flags since changed slots were cleared (see kSlotChanged*)
+    std::vector<std::uint8_t> changes{};
+
+    CellStorage() noexcept;
+    explicit CellStorage(int maxCellCount);
+  };
+
+  // Index list of cell indices for quick consequent access
+  IndexList _cellIndexList{};
+  // Cell property columns for quick random access
+  CellStorage _cells{};
+  // Texture data of each slot at the last takeChangedRows() call (loading snapshot keeps it
+  // as rendered texture keeps the previous world until changed rows are rendered again)
+  std::vector<CellTextureData> _takenCellTextureData{};
+  // Pool of cell genomes referenced by genome slot column
+  GenomeArena _genomeArena{};
+  // Mutex for genome slot allocation and release while cells are computed in parallel
+  std::mutex _genomeArenaMutex{};
+
+  // Pool of threads computing tiles (there is no pool if cells are computed sequentially)
+  std::unique_ptr<ThreadPool> _threadPool{};
+  // Stamp of current parallel tick (cells computed at it have it in act stamp column)
+  std::uint32_t _actStamp{};
+
+  // Struct for storing state of computing cells by one thread (random numbers and statistics)
+  struct ActContext {
+    RandomStream randomStream{};
+    bool         isParallel{};
+
+    int  countOfLiveCells{};
+    int  countOfDeadCells{};
+    long countOfBuds{};
+    long countOfPhotosynthesisEnergyBursts{};
+    long countOfMineralEnergyBursts{};
+    long countOfFoodEnergyBursts{};
+
+#ifdef CELLARIUM_PROFILING
+    Profile profile{};
+#endif
+  };
+
+  // Struct for storing environment lookup tables with parameters they were built with
+  struct EnvironmentTables {
+    // Photosynthesis energy per row
+    std::vector<int> photosynthesisEnergies{};
+    int              maxPhotosynthesisDepth{-1};
+    int              maxBurstOfPhotosynthesisEnergy{-1};
+
+    // Whether it is day per column
+    std::vector<std::uint8_t> daylightMask{};
+    int                       sunPosition{-1};
+    float                     daytimeWidthRatio{-1.0f};
+
+    // Minerals per row
+    std::vector<int> minerals{};
+    int              maxMineralHeight{-1};
+    int              maxBurstOfMinerals{-1};
+
+    // Mineral energy per minerals count in [0, maxMinerals]
+    std::vector<int> mineralEnergies{};
+    float            energyPerMineral{-1.0f};
+  };
+
+  // Environment lookup tables for quick calculation of bursts of energy
+  EnvironmentTables _environmentTables{};
 
   // Simulation time counters
   int _ticksNumber{};
@@ -276,8 +477,13 @@ class CellController {
   long _countOfMineralEnergyBursts{};
   long _countOfFoodEnergyBursts{};
 
-  // Selected cell pointer
-  const Cell *_selectedCellPtr{};
+#ifdef CELLARIUM_PROFILING
+  // Execution profile counters
+  Profile _profile{};
+#endif
+
+  // Selected cell index (atomic as cells are moved and removed in parallel)
+  std::atomic<int> _selectedCellIndex{-1};
 
  public:
   // Constructors
@@ -294,6 +500,15 @@ class CellController {
 
   // Puts RenderingData of each cell to given array
   void render(CellRenderingData *cellRenderingData, int cellRenderingMode = 0);
+  // Puts CellTextureData of each slot of flagged rows (all the rows if there are no row flags)
+  // taken by the last takeChangedRows() call to given array of columns * rows elements
+  // (row after row)
+  void renderTexture(CellTextureData *cellTextureData, const std::uint8_t *rowFlags = nullptr);
+
+  // Flags rows with slots whose CellTextureData has changed since the previous call
+  // in given array (slots changed for rendering are only compared with the previous data,
+  // dense worlds change almost every row each tick as energy of live cells changes)
+  void takeChangedRows(std::uint8_t *rowFlags) noexcept;
 
   // Returns count of cells
   size_t getCellCount() const noexcept;
@@ -306,54 +521,127 @@ class CellController {
   // Returns simulation statistics
   Statistics getSimulationStatistics() const noexcept;
 
+  // Returns view of cell property columns without copying them
+  CellGridView getCellGridView() const noexcept;
+
+  // Returns snapshot of simulation state (see snapshot.hpp for format)
+  std::vector<std::uint8_t> saveSnapshot() const;
+  // Returns delta snapshot of grid slots changed since changed slots were cleared
+  // (parent checksum is checksum of snapshot saved at that moment)
+  std::vector<std::uint8_t> saveDeltaSnapshot(std::uint64_t parentChecksum) const;
+  // Forgets changed grid slots (called after snapshot or delta snapshot is saved)
+  void clearChangedSlots() noexcept;
+  // Restores simulation state from snapshot which may be memory-mapped file
+  // (returns -1 and keeps current state if snapshot is invalid,
+  // on success invalidates cell grid views got before)
+  int loadSnapshot(const std::uint8_t *snapshot, size_t snapshotSize);
+  // Applies delta snapshot to state restored from its parent snapshot (the same way as above)
+  int loadDeltaSnapshot(const std::uint8_t *deltaSnapshot, size_t deltaSnapshotSize);
+
+  // Writes snapshot to file and restores simulation state from it
+  int saveSnapshotFile(const std::string &filename) const;
+  int loadSnapshotFile(const std::string &filename);
+
+  // Return and apply parameters which can be changed while simulation runs
+  // (returns -1 and keeps current parameters if they are invalid)
+  SnapshotParameters getParameters() const noexcept;
+  int                setParameters(const SnapshotParameters &parameters);
+
+  // Returns hash of cells, time, statistics counters and pseudo-random numbers generator state
+  // (equal hashes mean simulations go the same way, it costs a few ticks as it reads genomes)
+  std::uint64_t calculateStateHash() const noexcept;
+
   // Getters
   int getColumns() const noexcept;
   int getRows() const noexcept;
+  int getGenomeSize() const noexcept;
   int getMaxPhotosynthesisDepth() const noexcept;
   int getMaxMineralHeight() const noexcept;
 
-  // Select cell and return selected cell
+  // Select cell and copy selected cell to given one
   bool selectCell(int column, int row) noexcept;
-  const Cell *getSelectedCell() const noexcept;
-
-  // Friend function for viewing and changing class properties
-  friend void processSimulationParameters(CellController &cellController);
+  bool getSelectedCell(Cell &cell) const;
 
  private:
+  // Computes one simulation tick with enabling flags known at compile time (see kActFlag*)
+  template <std::uint32_t kActFlags>
+  void actWithFlags() noexcept;
+  // Picks act() specialization if enabling flags or genome interpreter have changed
+  void updateActFunction() noexcept;
+
+  // Returns enabling flag members in Params declaration order (snapshot stores them as bits)
+  static const std::array<bool CellController::*, kSnapshotEnablingFlagCount>
+      &getEnablingFlagMembers() noexcept;
+
+  // Return and apply snapshot world record (grid size and cells are not applied)
+  SnapshotWorld getSnapshotWorld() const noexcept;
+  void          setSnapshotWorld(const SnapshotWorld &world);
+  // Return snapshot record of cell properties and copy cell genome to snapshot
+  SnapshotCell getSnapshotCell(int index, bool hasGenome) const noexcept;
+  void         copySnapshotGenome(int index, std::uint8_t *genomeData) const noexcept;
+  // Copies snapshot record of cell properties to cell storage columns
+  static void setSnapshotCell(CellStorage &cells, const SnapshotCell &cell) noexcept;
+
+  // Compute cells sequentially in index list order or in tiles in parallel
+  template <std::uint32_t kActFlags>
+  void actSequentially() noexcept;
+  template <std::uint32_t kActFlags>
+  void actInTiles() noexcept;
+  // Computes one cell
+  template <std::uint32_t kActFlags>
+  void actCell(int index, ActContext &context) noexcept;
+  // Adds statistics counted while computing cells
+  void addStatistics(const ActContext &context) noexcept;
+
   // Updates tick counters
   void updateTime() noexcept;
+  // Rebuilds environment lookup tables whose parameters or day phase have changed
+  void updateEnvironmentTables() noexcept;
 
   // Makes every cell mutate
   void gammaFlash() noexcept;
 
+  // Execute cell genome instructions with maximum instructions per tick limit
+  // (interpreters produce identical results and return cell index after possible move)
+  template <std::uint32_t kActFlags>
+  int interpretGenomeWithSwitch(int index, ActContext &context) noexcept;
+  template <std::uint32_t kActFlags>
+  int interpretGenomeWithThreadedCode(int index, ActContext &context) noexcept;
+
   // Perform appropriate cell genome instructions
-  void turn(Cell &cell) const noexcept;
-  void move(Cell &cell) noexcept;
-  void getEnergyFromPhotosynthesis(Cell &cell) noexcept;
-  void getEnergyFromMinerals(Cell &cell) noexcept;
-  void getEnergyFromFood(Cell &cell) noexcept;
-  void bud(Cell &cell) noexcept;
-  void mutateRandomGene(Cell &cell) noexcept;
-  void shareEnergy(Cell &cell) const noexcept;
-  void touch(Cell &cell) const noexcept;
-  void determineEnergyLevel(Cell &cell) const noexcept;
-  void determineDepth(Cell &cell) const noexcept;
-  void determineBurstOfPhotosynthesisEnergy(Cell &cell) const noexcept;
-  void determineBurstOfMinerals(Cell &cell) const noexcept;
-  void determineBurstOfMineralEnergy(Cell &cell) const noexcept;
-  void incrementGenomCounter(Cell &cell) const noexcept;
+  void turn(int index) noexcept;
+  int  move(int index, ActContext &context) noexcept;
+  void getEnergyFromPhotosynthesis(int index, ActContext &context) noexcept;
+  void getEnergyFromMinerals(int index, ActContext &context) noexcept;
+  void getEnergyFromFood(int index, ActContext &context) noexcept;
+  void bud(int index, ActContext &context) noexcept;
+  void mutateRandomGene(int index, ActContext &context) noexcept;
+  void shareEnergy(int index) noexcept;
+  void touch(int index, ActContext &context) noexcept;
+  void determineEnergyLevel(int index) noexcept;
+  void determineDepth(int index) noexcept;
+  void determineBurstOfPhotosynthesisEnergy(int index) noexcept;
+  void determineBurstOfMinerals(int index) noexcept;
+  void determineBurstOfMineralEnergy(int index) noexcept;
+  void incrementGenomCounter(int index) noexcept;
 
   // Perform cell genome calculations
-  void addGenToCounter(Cell &cell) const noexcept;
-  void jumpCounter(Cell &cell, int offset) const noexcept;
-  int  getNextNthGen(const Cell &cell, int n) const noexcept;
-  bool areAkin(const Cell &cell1, const Cell &cell2) const noexcept;
+  void addGenToCounter(int index) noexcept;
+  void jumpCounter(int index, int offset) noexcept;
+  int  getNextNthGen(int index, int n) const noexcept;
+  bool areAkin(int index1, int index2) const noexcept;
 
   // Calculate bursts of energy and minerals
   int calculateBurstOfPhotosynthesisEnergy(int index) const noexcept;
   int calculateBurstOfMinerals(int index) const noexcept;
   int calculateBurstOfMineralEnergy(int minerals) const noexcept;
 
+  // Calculates color of cell in given rendering mode
+  void calculateCellColor(int index, int cellRenderingMode, float &colorR, float &colorG,
+                          float &colorB) const noexcept;
+  // Calculates texture data of slot
+  CellTextureData calculateCellTextureData(int index) const noexcept;
+
   // Calculate indices, columns and rows
   int calculateColumnByIndex(int index) const noexcept;
   int calculateRowByIndex(int index) const noexcept;
@@ -361,8 +649,8 @@ class CellController {
   int calculateIndexByIndexAndDirection(int index, int direction) const noexcept;
 
   // Add and remove cells
-  void addCell(std::unique_ptr<Cell> cellPtr) noexcept;
-  void removeCell(std::unique_ptr<Cell> cellPtr) noexcept;
+  void addCell(int index, int genomeSlot, int energy, int direction, ActContext &context) noexcept;
+  void removeCell(int index, ActContext &context) noexcept;
 };
 
 }
@@ -0,0 +1,100 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Header file
+#include "./checkpointer.hpp"
+
+// STD
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+// Using header file namespace
+using namespace cellarium;
+
+// Returns name of delta snapshot file with given number in the chain
+static std::string getDeltaFilename(const std::string &filename, int deltaNumber) {
+  return filename + "." + std::to_string(deltaNumber);
+}
+
+Checkpointer::Checkpointer() noexcept {}
+
+Checkpointer::Checkpointer(const std::string &filename, int maxDeltaCount)
+    : _filename{filename}, _maxDeltaCount{std::max(maxDeltaCount, 0)} {}
+
+int Checkpointer::write(CellController &cellController) {
+  // Compacting chain into full snapshot if there is no chain or it is long enough
+  if (_deltaCount == -1 || _deltaCount >= _maxDeltaCount) {
+    const std::vector<std::uint8_t> snapshot{cellController.saveSnapshot()};
+    if (writeSnapshotFile(_filename, snapshot) != 0) {
+      return -1;
+    }
+
+    // Removing delta snapshots of the previous chain (stale ones would not match checksum anyway)
+    for (int i = 1; std::remove(getDeltaFilename(_filename, i).c_str()) == 0; ++i) {
+    }
+
+    _deltaCount   = 0;
+    _lastChecksum = getSnapshotHeader(snapshot).checksum;
+  }
+  // Writing delta snapshot continuing chain otherwise
+  else {
+    const std::vector<std::uint8_t> deltaSnapshot{cellController.saveDeltaSnapshot(_lastChecksum)};
+    if (writeSnapshotFile(getDeltaFilename(_filename, _deltaCount + 1), deltaSnapshot) != 0) {
+      return -1;
+    }
+
+    ++_deltaCount;
+    _lastChecksum = getSnapshotHeader(deltaSnapshot).checksum;
+  }
+
+  // Starting tracking of changes since this checkpoint
+  cellController.clearChangedSlots();
+
+  return 0;
+}
+
+int Checkpointer::read(CellController &cellController) {
+  // Restoring simulation from full snapshot
+  std::vector<std::uint8_t> snapshot{};
+  if (readSnapshotFile(_filename, snapshot) != 0 ||
+      cellController.loadSnapshot(snapshot.data(), snapshot.size()) != 0) {
+    return -1;
+  }
+  _deltaCount   = 0;
+  _lastChecksum = getSnapshotHeader(snapshot).checksum;
+
+  // Applying delta snapshots while they exist and continue chain
+  // (ones left from the previous chain if compaction was interrupted have other parent)
+  for (int i = 1;; ++i) {
+    const std::string deltaFilename{getDeltaFilename(_filename, i)};
+    if (!std::ifstream{deltaFilename, std::ios::binary}.is_open()) {
+      break;
+    }
+
+    std::vector<std::uint8_t> deltaSnapshot{};
+    if (readSnapshotFile(deltaFilename, deltaSnapshot) != 0) {
+      return -1;
+    }
+    if (deltaSnapshot.size() < sizeof(SnapshotHeader) ||
+        getSnapshotHeader(deltaSnapshot).parentChecksum != _lastChecksum) {
+      break;
+    }
+    if (cellController.loadDeltaSnapshot(deltaSnapshot.data(), deltaSnapshot.size()) != 0) {
+      return -1;
+    }
+
+    _deltaCount   = i;
+    _lastChecksum = getSnapshotHeader(deltaSnapshot).checksum;
+  }
+
+  return 0;
+}
+
+const std::string &Checkpointer::getFilename() const noexcept { return _filename; }
+
+int Checkpointer::getDeltaCount() const noexcept { return _deltaCount; }
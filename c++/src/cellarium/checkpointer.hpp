@@ -0,0 +1,49 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef CHECKPOINTER_HPP
+#define CHECKPOINTER_HPP
+
+// STD
+#include <cstdint>
+#include <string>
+
+// "cell_controller" internal header
+#include "./cell_controller.hpp"
+
+namespace cellarium {
+
+// Class for writing checkpoints of simulation as chain of full snapshot file (filename)
+// and delta snapshot files (filename.1, filename.2, ...) compacted into new full snapshot
+// each time chain reaches maximal count of delta snapshots
+class Checkpointer {
+ private:
+  std::string _filename{};
+  int         _maxDeltaCount{};
+
+  // Count of delta snapshots in the chain (-1 if there is no full snapshot yet)
+  // and checksum of the last snapshot in it
+  int           _deltaCount{-1};
+  std::uint64_t _lastChecksum{};
+
+ public:
+  Checkpointer() noexcept;
+  Checkpointer(const std::string &filename, int maxDeltaCount);
+
+  // Writes full snapshot if chain is empty or long enough and delta snapshot otherwise
+  // (delta snapshot holds grid slots changed since the previous checkpoint)
+  int write(CellController &cellController);
+  // Restores simulation from full snapshot and delta snapshots continuing it
+  // (and continues chain from the last of them)
+  int read(CellController &cellController);
+
+  const std::string &getFilename() const noexcept;
+  int                getDeltaCount() const noexcept;
+};
+
+}
+
+#endif
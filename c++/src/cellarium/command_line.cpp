@@ -12,7 +12,6 @@
 #include <iostream>
 
 // Qt
-#include <QByteArray>
 #include <QCommandLineParser>
 #include <QCoreApplication>
 #include <QDateTime>
@@ -23,6 +22,9 @@
 #include <QString>
 #include <QStringList>
 
+// Headers of other compile unit
+#include "./configuration.hpp"
+
 // Outputs version and license
 void outputVersionAndLicense() {
   std::cout << "cellarium (maldenol) 1.0.0\n";
@@ -64,6 +66,7 @@ int generateDefaultConfigurationFile() {
   configJsonObject.insert("ticksPerRender", 1);
   configJsonObject.insert("enableRendering", true);
   configJsonObject.insert("enableRenderingEnvironment", true);
+  configJsonObject.insert("enableTextureRendering", true);
   configJsonObject.insert("enablePause", false);
   configJsonObject.insert("enableFullscreenMode", false);
   configJsonObject.insert("enableVSync", true);
@@ -139,6 +142,10 @@ int generateDefaultConfigurationFile() {
   configJsonObject.insert("firstCellEnergyMultiplier", cellarium::kInitFirstCellEnergyMultiplier);
   configJsonObject.insert("firstCellDirection", cellarium::kInitFirstCellDirection);
   configJsonObject.insert("firstCellIndexMultiplier", cellarium::kInitFirstCellIndexMultiplier);
+  configJsonObject.insert("genomeInterpreter", static_cast<int>(cellarium::kInitGenomeInterpreter));
+  configJsonObject.insert("threadCount", cellarium::kInitThreadCount);
+  configJsonObject.insert("tileWidth", cellarium::kInitTileWidth);
+  configJsonObject.insert("tileHeight", cellarium::kInitTileHeight);
 
   // Writing configuration to file
   QJsonDocument configJsonDocument{configJsonObject};
@@ -150,18 +157,12 @@ int generateDefaultConfigurationFile() {
 // Load configuration file
 int loadConfigurationFile(const QString &filename, Controls &controls,
                           cellarium::CellController::Params &cellControllerParams) {
-  // Opening config file
-  QFile configFile{filename};
-  if (!configFile.open(QFile::ReadOnly | QFile::Text)) {
-    std::cout << "error: cannot open " << filename.toStdString() << std::endl;
+  // Reading configuration from file
+  QJsonObject configJsonObject{};
+  if (readConfigurationFile(filename, configJsonObject) != 0) {
     return -1;
   }
 
-  // Reading configuration from file
-  QByteArray    configByteArray{configFile.readAll()};
-  QJsonDocument configJsonDocument{QJsonDocument::fromJson(configByteArray)};
-  QJsonObject   configJsonObject{configJsonDocument.object()};
-
   // Updating Controls
   controls.cellRenderingMode = configJsonObject.contains("cellRenderingMode")
                                    ? configJsonObject["cellRenderingMode"].toInt()
@@ -176,6 +177,10 @@ int loadConfigurationFile(const QString &filename, Controls &controls,
       configJsonObject.contains("enableRenderingEnvironment")
           ? configJsonObject["enableRenderingEnvironment"].toBool()
           : controls.enableRenderingEnvironment;
+  controls.enableTextureRendering =
+      configJsonObject.contains("enableTextureRendering")
+          ? configJsonObject["enableTextureRendering"].toBool()
+          : controls.enableTextureRendering;
   controls.enablePause          = configJsonObject.contains("enablePause")
                                       ? configJsonObject["enablePause"].toBool()
                                       : controls.enablePause;
@@ -187,201 +192,7 @@ int loadConfigurationFile(const QString &filename, Controls &controls,
                                       : controls.enableVSync;
 
   // Updating CellController::Params
-  cellControllerParams.mersenneTwisterEngine =
-      configJsonObject.contains("randomSeed")
-          ? std::mt19937{static_cast<unsigned int>(configJsonObject["randomSeed"].toInt())}
-          : cellControllerParams.mersenneTwisterEngine;
-  cellControllerParams.randomSeed = configJsonObject.contains("randomSeed")
-                                        ? configJsonObject["randomSeed"].toInt()
-                                        : cellControllerParams.randomSeed;
-  cellControllerParams.width      = configJsonObject.contains("width")
-                                        ? configJsonObject["width"].toInt()
-                                        : cellControllerParams.width;
-  cellControllerParams.height     = configJsonObject.contains("height")
-                                        ? configJsonObject["height"].toInt()
-                                        : cellControllerParams.height;
-  cellControllerParams.cellSize   = configJsonObject.contains("cellSize")
-                                        ? static_cast<float>(configJsonObject["cellSize"].toDouble())
-                                        : cellControllerParams.cellSize;
-  cellControllerParams.maxPhotosynthesisDepthMultiplier =
-      configJsonObject.contains("maxPhotosynthesisDepthMultiplier")
-          ? static_cast<float>(configJsonObject["maxPhotosynthesisDepthMultiplier"].toDouble())
-          : cellControllerParams.maxPhotosynthesisDepthMultiplier;
-  cellControllerParams.maxMineralHeightMultiplier =
-      configJsonObject.contains("maxMineralHeightMultiplier")
-          ? static_cast<float>(configJsonObject["maxMineralHeightMultiplier"].toDouble())
-          : cellControllerParams.maxMineralHeightMultiplier;
-  cellControllerParams.genomeSize = configJsonObject.contains("genomeSize")
-                                        ? configJsonObject["genomeSize"].toInt()
-                                        : cellControllerParams.genomeSize;
-  cellControllerParams.maxInstructionsPerTick =
-      configJsonObject.contains("maxInstructionsPerTick")
-          ? configJsonObject["maxInstructionsPerTick"].toInt()
-          : cellControllerParams.maxInstructionsPerTick;
-  cellControllerParams.maxAkinGenomDifference =
-      configJsonObject.contains("maxAkinGenomDifference")
-          ? configJsonObject["maxAkinGenomDifference"].toInt()
-          : cellControllerParams.maxAkinGenomDifference;
-  cellControllerParams.minChildEnergy = configJsonObject.contains("minChildEnergy")
-                                            ? configJsonObject["minChildEnergy"].toInt()
-                                            : cellControllerParams.minChildEnergy;
-  cellControllerParams.maxEnergy      = configJsonObject.contains("maxEnergy")
-                                            ? configJsonObject["maxEnergy"].toInt()
-                                            : cellControllerParams.maxEnergy;
-  cellControllerParams.maxBurstOfPhotosynthesisEnergy =
-      configJsonObject.contains("maxBurstOfPhotosynthesisEnergy")
-          ? configJsonObject["maxBurstOfPhotosynthesisEnergy"].toInt()
-          : cellControllerParams.maxBurstOfPhotosynthesisEnergy;
-  cellControllerParams.summerDaytimeToWholeDayRatio =
-      configJsonObject.contains("summerDaytimeToWholeDayRatio")
-          ? static_cast<float>(configJsonObject["summerDaytimeToWholeDayRatio"].toDouble())
-          : cellControllerParams.summerDaytimeToWholeDayRatio;
-  cellControllerParams.maxMinerals        = configJsonObject.contains("maxMinerals")
-                                                ? configJsonObject["maxMinerals"].toInt()
-                                                : cellControllerParams.maxMinerals;
-  cellControllerParams.maxBurstOfMinerals = configJsonObject.contains("maxBurstOfMinerals")
-                                                ? configJsonObject["maxBurstOfMinerals"].toInt()
-                                                : cellControllerParams.maxBurstOfMinerals;
-  cellControllerParams.energyPerMineral =
-      configJsonObject.contains("energyPerMineral")
-          ? static_cast<float>(configJsonObject["energyPerMineral"].toDouble())
-          : cellControllerParams.energyPerMineral;
-  cellControllerParams.maxBurstOfFoodEnergy = configJsonObject.contains("maxBurstOfFoodEnergy")
-                                                  ? configJsonObject["maxBurstOfFoodEnergy"].toInt()
-                                                  : cellControllerParams.maxBurstOfFoodEnergy;
-  cellControllerParams.childBudMutationChance =
-      configJsonObject.contains("childBudMutationChance")
-          ? static_cast<float>(configJsonObject["childBudMutationChance"].toDouble())
-          : cellControllerParams.childBudMutationChance;
-  cellControllerParams.parentBudMutationChance =
-      configJsonObject.contains("parentBudMutationChance")
-          ? static_cast<float>(configJsonObject["parentBudMutationChance"].toDouble())
-          : cellControllerParams.parentBudMutationChance;
-  cellControllerParams.randomMutationChance =
-      configJsonObject.contains("randomMutationChance")
-          ? static_cast<float>(configJsonObject["randomMutationChance"].toDouble())
-          : cellControllerParams.randomMutationChance;
-  cellControllerParams.dayDurationInTicks   = configJsonObject.contains("dayDurationInTicks")
-                                                  ? configJsonObject["dayDurationInTicks"].toInt()
-                                                  : cellControllerParams.dayDurationInTicks;
-  cellControllerParams.seasonDurationInDays = configJsonObject.contains("seasonDurationInDays")
-                                                  ? configJsonObject["seasonDurationInDays"].toInt()
-                                                  : cellControllerParams.seasonDurationInDays;
-  cellControllerParams.gammaFlashPeriodInDays =
-      configJsonObject.contains("gammaFlashPeriodInDays")
-          ? configJsonObject["gammaFlashPeriodInDays"].toInt()
-          : cellControllerParams.gammaFlashPeriodInDays;
-  cellControllerParams.gammaFlashMaxMutationsCount =
-      configJsonObject.contains("gammaFlashMaxMutationsCount")
-          ? configJsonObject["gammaFlashMaxMutationsCount"].toInt()
-          : cellControllerParams.gammaFlashMaxMutationsCount;
-  cellControllerParams.enableInstructionTurn =
-      configJsonObject.contains("enableInstructionTurn")
-          ? configJsonObject["enableInstructionTurn"].toBool()
-          : cellControllerParams.enableInstructionTurn;
-  cellControllerParams.enableInstructionMove =
-      configJsonObject.contains("enableInstructionMove")
-          ? configJsonObject["enableInstructionMove"].toBool()
-          : cellControllerParams.enableInstructionMove;
-  cellControllerParams.enableInstructionGetEnergyFromPhotosynthesis =
-      configJsonObject.contains("enableInstructionGetEnergyFromPhotosynthesis")
-          ? configJsonObject["enableInstructionGetEnergyFromPhotosynthesis"].toBool()
-          : cellControllerParams.enableInstructionGetEnergyFromPhotosynthesis;
-  cellControllerParams.enableInstructionGetEnergyFromMinerals =
-      configJsonObject.contains("enableInstructionGetEnergyFromMinerals")
-          ? configJsonObject["enableInstructionGetEnergyFromMinerals"].toBool()
-          : cellControllerParams.enableInstructionGetEnergyFromMinerals;
-  cellControllerParams.enableInstructionGetEnergyFromFood =
-      configJsonObject.contains("enableInstructionGetEnergyFromFood")
-          ? configJsonObject["enableInstructionGetEnergyFromFood"].toBool()
-          : cellControllerParams.enableInstructionGetEnergyFromFood;
-  cellControllerParams.enableInstructionBud =
-      configJsonObject.contains("enableInstructionBud")
-          ? configJsonObject["enableInstructionBud"].toBool()
-          : cellControllerParams.enableInstructionBud;
-  cellControllerParams.enableInstructionMutateRandomGene =
-      configJsonObject.contains("enableInstructionMutateRandomGene")
-          ? configJsonObject["enableInstructionMutateRandomGene"].toBool()
-          : cellControllerParams.enableInstructionMutateRandomGene;
-  cellControllerParams.enableInstructionShareEnergy =
-      configJsonObject.contains("enableInstructionShareEnergy")
-          ? configJsonObject["enableInstructionShareEnergy"].toBool()
-          : cellControllerParams.enableInstructionShareEnergy;
-  cellControllerParams.enableInstructionTouch =
-      configJsonObject.contains("enableInstructionTouch")
-          ? configJsonObject["enableInstructionTouch"].toBool()
-          : cellControllerParams.enableInstructionTouch;
-  cellControllerParams.enableInstructionDetermineEnergyLevel =
-      configJsonObject.contains("enableInstructionDetermineEnergyLevel")
-          ? configJsonObject["enableInstructionDetermineEnergyLevel"].toBool()
-          : cellControllerParams.enableInstructionDetermineEnergyLevel;
-  cellControllerParams.enableInstructionDetermineDepth =
-      configJsonObject.contains("enableInstructionDetermineDepth")
-          ? configJsonObject["enableInstructionDetermineDepth"].toBool()
-          : cellControllerParams.enableInstructionDetermineDepth;
-  cellControllerParams.enableInstructionDetermineBurstOfPhotosynthesisEnergy =
-      configJsonObject.contains("enableInstructionDetermineBurstOfPhotosynthesisEnergy")
-          ? configJsonObject["enableInstructionDetermineBurstOfPhotosynthesisEnergy"].toBool()
-          : cellControllerParams.enableInstructionDetermineBurstOfPhotosynthesisEnergy;
-  cellControllerParams.enableInstructionDetermineBurstOfMinerals =
-      configJsonObject.contains("enableInstructionDetermineBurstOfMinerals")
-          ? configJsonObject["enableInstructionDetermineBurstOfMinerals"].toBool()
-          : cellControllerParams.enableInstructionDetermineBurstOfMinerals;
-  cellControllerParams.enableInstructionDetermineBurstOfMineralEnergy =
-      configJsonObject.contains("enableInstructionDetermineBurstOfMineralEnergy")
-          ? configJsonObject["enableInstructionDetermineBurstOfMineralEnergy"].toBool()
-          : cellControllerParams.enableInstructionDetermineBurstOfMineralEnergy;
-  cellControllerParams.enableZeroEnergyOrganic =
-      configJsonObject.contains("enableZeroEnergyOrganic")
-          ? configJsonObject["enableZeroEnergyOrganic"].toBool()
-          : cellControllerParams.enableZeroEnergyOrganic;
-  cellControllerParams.enableForcedBuddingOnMaximalEnergyLevel =
-      configJsonObject.contains("enableForcedBuddingOnMaximalEnergyLevel")
-          ? configJsonObject["enableForcedBuddingOnMaximalEnergyLevel"].toBool()
-          : cellControllerParams.enableForcedBuddingOnMaximalEnergyLevel;
-  cellControllerParams.enableTryingToBudInUnoccupiedDirection =
-      configJsonObject.contains("enableTryingToBudInUnoccupiedDirection")
-          ? configJsonObject["enableTryingToBudInUnoccupiedDirection"].toBool()
-          : cellControllerParams.enableTryingToBudInUnoccupiedDirection;
-  cellControllerParams.enableDeathOnBuddingIfNotEnoughSpace =
-      configJsonObject.contains("enableDeathOnBuddingIfNotEnoughSpace")
-          ? configJsonObject["enableDeathOnBuddingIfNotEnoughSpace"].toBool()
-          : cellControllerParams.enableDeathOnBuddingIfNotEnoughSpace;
-  cellControllerParams.enableSeasons  = configJsonObject.contains("enableSeasons")
-                                            ? configJsonObject["enableSeasons"].toBool()
-                                            : cellControllerParams.enableSeasons;
-  cellControllerParams.enableDaytimes = configJsonObject.contains("enableDaytimes")
-                                            ? configJsonObject["enableDaytimes"].toBool()
-                                            : cellControllerParams.enableDaytimes;
-  cellControllerParams.enableMaximizingFoodEnergy =
-      configJsonObject.contains("enableMaximizingFoodEnergy")
-          ? configJsonObject["enableMaximizingFoodEnergy"].toBool()
-          : cellControllerParams.enableMaximizingFoodEnergy;
-  cellControllerParams.enableDeadCellPinningOnSinking =
-      configJsonObject.contains("enableDeadCellPinningOnSinking")
-          ? configJsonObject["enableDeadCellPinningOnSinking"].toBool()
-          : cellControllerParams.enableDeadCellPinningOnSinking;
-  if (configJsonObject.contains("firstCellGenome")) {
-    QJsonArray       firstCellGenomeArray = configJsonObject["firstCellGenome"].toArray();
-    std::vector<int> firstCellGenome;
-    for (QJsonValueRef &&firstCellGenomeInstruction : firstCellGenomeArray) {
-      firstCellGenome.push_back(firstCellGenomeInstruction.toInt());
-    }
-    cellControllerParams.firstCellGenome = firstCellGenome;
-  }
-  cellControllerParams.firstCellEnergyMultiplier =
-      configJsonObject.contains("firstCellEnergyMultiplier")
-          ? static_cast<float>(configJsonObject["firstCellEnergyMultiplier"].toDouble())
-          : cellControllerParams.firstCellEnergyMultiplier;
-  cellControllerParams.firstCellDirection = configJsonObject.contains("firstCellDirection")
-                                                ? configJsonObject["firstCellDirection"].toInt()
-                                                : cellControllerParams.firstCellDirection;
-  cellControllerParams.firstCellIndexMultiplier =
-      configJsonObject.contains("firstCellIndexMultiplier")
-          ? static_cast<float>(configJsonObject["firstCellIndexMultiplier"].toDouble())
-          : cellControllerParams.firstCellIndexMultiplier;
-
-  return 0;
+  return loadCellControllerParams(configJsonObject, cellControllerParams);
 }
 
 // Processes command line arguments updating CellController::Params and Controls
@@ -413,6 +224,12 @@ int processCommandLineArguments(int argc, char *argv[], const std::string &title
       {QStringList() << "g"
                      << "generate",
        QCoreApplication::translate("main", "Generates default configuration file.")});
+  commandLineParser.addOption(
+      {QStringList() << "r"
+                     << "record",
+       QCoreApplication::translate(
+           "main", "Replay log to record parameter changes and state hashes to."),
+       "log"});
 
   // Processing QCommandLineParser and getting positional arguments
   commandLineParser.process(qCoreApplication);
@@ -442,6 +259,9 @@ int processCommandLineArguments(int argc, char *argv[], const std::string &title
     return -1;
   }
 
+  // Getting replay log to record
+  controls.replayLogFilename = commandLineParser.value("record").toStdString();
+
   // Loading configuration file
   return loadConfigurationFile(positionalArgumentList.at(0), controls, cellControllerParams);
 }
@@ -0,0 +1,255 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Header file
+#include "./configuration.hpp"
+
+// STD
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Qt
+#include <QByteArray>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+// Reads configuration file to JSON object
+int readConfigurationFile(const QString &filename, QJsonObject &configJsonObject) {
+  // Opening config file
+  QFile configFile{filename};
+  if (!configFile.open(QFile::ReadOnly | QFile::Text)) {
+    std::cout << "error: cannot open " << filename.toStdString() << std::endl;
+    return -1;
+  }
+
+  // Reading configuration from file
+  QByteArray    configByteArray{configFile.readAll()};
+  QJsonDocument configJsonDocument{QJsonDocument::fromJson(configByteArray)};
+  configJsonObject = configJsonDocument.object();
+
+  return 0;
+}
+
+// Updates CellController::Params with values of JSON object (absent values are left unchanged)
+int loadCellControllerParams(const QJsonObject                 &configJsonObject,
+                             cellarium::CellController::Params &cellControllerParams) {
+  cellControllerParams.mersenneTwisterEngine =
+      configJsonObject.contains("randomSeed")
+          ? std::mt19937{static_cast<unsigned int>(configJsonObject["randomSeed"].toInt())}
+          : cellControllerParams.mersenneTwisterEngine;
+  cellControllerParams.randomSeed = configJsonObject.contains("randomSeed")
+                                        ? configJsonObject["randomSeed"].toInt()
+                                        : cellControllerParams.randomSeed;
+  cellControllerParams.width      = configJsonObject.contains("width")
+                                        ? configJsonObject["width"].toInt()
+                                        : cellControllerParams.width;
+  cellControllerParams.height     = configJsonObject.contains("height")
+                                        ? configJsonObject["height"].toInt()
+                                        : cellControllerParams.height;
+  cellControllerParams.cellSize   = configJsonObject.contains("cellSize")
+                                        ? static_cast<float>(configJsonObject["cellSize"].toDouble())
+                                        : cellControllerParams.cellSize;
+  cellControllerParams.maxPhotosynthesisDepthMultiplier =
+      configJsonObject.contains("maxPhotosynthesisDepthMultiplier")
+          ? static_cast<float>(configJsonObject["maxPhotosynthesisDepthMultiplier"].toDouble())
+          : cellControllerParams.maxPhotosynthesisDepthMultiplier;
+  cellControllerParams.maxMineralHeightMultiplier =
+      configJsonObject.contains("maxMineralHeightMultiplier")
+          ? static_cast<float>(configJsonObject["maxMineralHeightMultiplier"].toDouble())
+          : cellControllerParams.maxMineralHeightMultiplier;
+  cellControllerParams.genomeSize = configJsonObject.contains("genomeSize")
+                                        ? configJsonObject["genomeSize"].toInt()
+                                        : cellControllerParams.genomeSize;
+  cellControllerParams.maxInstructionsPerTick =
+      configJsonObject.contains("maxInstructionsPerTick")
+          ? configJsonObject["maxInstructionsPerTick"].toInt()
+          : cellControllerParams.maxInstructionsPerTick;
+  cellControllerParams.maxAkinGenomDifference =
+      configJsonObject.contains("maxAkinGenomDifference")
+          ? configJsonObject["maxAkinGenomDifference"].toInt()
+          : cellControllerParams.maxAkinGenomDifference;
+  cellControllerParams.minChildEnergy = configJsonObject.contains("minChildEnergy")
+                                            ? configJsonObject["minChildEnergy"].toInt()
+                                            : cellControllerParams.minChildEnergy;
+  cellControllerParams.maxEnergy      = configJsonObject.contains("maxEnergy")
+                                            ? configJsonObject["maxEnergy"].toInt()
+                                            : cellControllerParams.maxEnergy;
+  cellControllerParams.maxBurstOfPhotosynthesisEnergy =
+      configJsonObject.contains("maxBurstOfPhotosynthesisEnergy")
+          ? configJsonObject["maxBurstOfPhotosynthesisEnergy"].toInt()
+          : cellControllerParams.maxBurstOfPhotosynthesisEnergy;
+  cellControllerParams.summerDaytimeToWholeDayRatio =
+      configJsonObject.contains("summerDaytimeToWholeDayRatio")
+          ? static_cast<float>(configJsonObject["summerDaytimeToWholeDayRatio"].toDouble())
+          : cellControllerParams.summerDaytimeToWholeDayRatio;
+  cellControllerParams.maxMinerals        = configJsonObject.contains("maxMinerals")
+                                                ? configJsonObject["maxMinerals"].toInt()
+                                                : cellControllerParams.maxMinerals;
+  cellControllerParams.maxBurstOfMinerals = configJsonObject.contains("maxBurstOfMinerals")
+                                                ? configJsonObject["maxBurstOfMinerals"].toInt()
+                                                : cellControllerParams.maxBurstOfMinerals;
+  cellControllerParams.energyPerMineral =
+      configJsonObject.contains("energyPerMineral")
+          ? static_cast<float>(configJsonObject["energyPerMineral"].toDouble())
+          : cellControllerParams.energyPerMineral;
+  cellControllerParams.maxBurstOfFoodEnergy = configJsonObject.contains("maxBurstOfFoodEnergy")
+                                                  ? configJsonObject["maxBurstOfFoodEnergy"].toInt()
+                                                  : cellControllerParams.maxBurstOfFoodEnergy;
+  cellControllerParams.childBudMutationChance =
+      configJsonObject.contains("childBudMutationChance")
+          ? static_cast<float>(configJsonObject["childBudMutationChance"].toDouble())
+          : cellControllerParams.childBudMutationChance;
+  cellControllerParams.parentBudMutationChance =
+      configJsonObject.contains("parentBudMutationChance")
+          ? static_cast<float>(configJsonObject["parentBudMutationChance"].toDouble())
+          : cellControllerParams.parentBudMutationChance;
+  cellControllerParams.randomMutationChance =
+      configJsonObject.contains("randomMutationChance")
+          ? static_cast<float>(configJsonObject["randomMutationChance"].toDouble())
+          : cellControllerParams.randomMutationChance;
+  cellControllerParams.dayDurationInTicks   = configJsonObject.contains("dayDurationInTicks")
+                                                  ? configJsonObject["dayDurationInTicks"].toInt()
+                                                  : cellControllerParams.dayDurationInTicks;
+  cellControllerParams.seasonDurationInDays = configJsonObject.contains("seasonDurationInDays")
+                                                  ? configJsonObject["seasonDurationInDays"].toInt()
+                                                  : cellControllerParams.seasonDurationInDays;
+  cellControllerParams.gammaFlashPeriodInDays =
+      configJsonObject.contains("gammaFlashPeriodInDays")
+          ? configJsonObject["gammaFlashPeriodInDays"].toInt()
+          : cellControllerParams.gammaFlashPeriodInDays;
+  cellControllerParams.gammaFlashMaxMutationsCount =
+      configJsonObject.contains("gammaFlashMaxMutationsCount")
+          ? configJsonObject["gammaFlashMaxMutationsCount"].toInt()
+          : cellControllerParams.gammaFlashMaxMutationsCount;
+  cellControllerParams.enableInstructionTurn =
+      configJsonObject.contains("enableInstructionTurn")
+          ? configJsonObject["enableInstructionTurn"].toBool()
+          : cellControllerParams.enableInstructionTurn;
+  cellControllerParams.enableInstructionMove =
+      configJsonObject.contains("enableInstructionMove")
+          ? configJsonObject["enableInstructionMove"].toBool()
+          : cellControllerParams.enableInstructionMove;
+  cellControllerParams.enableInstructionGetEnergyFromPhotosynthesis =
+      configJsonObject.contains("enableInstructionGetEnergyFromPhotosynthesis")
+          ? configJsonObject["enableInstructionGetEnergyFromPhotosynthesis"].toBool()
+          : cellControllerParams.enableInstructionGetEnergyFromPhotosynthesis;
+  cellControllerParams.enableInstructionGetEnergyFromMinerals =
+      configJsonObject.contains("enableInstructionGetEnergyFromMinerals")
+          ? configJsonObject["enableInstructionGetEnergyFromMinerals"].toBool()
+          : cellControllerParams.enableInstructionGetEnergyFromMinerals;
+  cellControllerParams.enableInstructionGetEnergyFromFood =
+      configJsonObject.contains("enableInstructionGetEnergyFromFood")
+          ? configJsonObject["enableInstructionGetEnergyFromFood"].toBool()
+          : cellControllerParams.enableInstructionGetEnergyFromFood;
+  cellControllerParams.enableInstructionBud =
+      configJsonObject.contains("enableInstructionBud")
+          ? configJsonObject["enableInstructionBud"].toBool()
+          : cellControllerParams.enableInstructionBud;
+  cellControllerParams.enableInstructionMutateRandomGene =
+      configJsonObject.contains("enableInstructionMutateRandomGene")
+          ? configJsonObject["enableInstructionMutateRandomGene"].toBool()
+          : cellControllerParams.enableInstructionMutateRandomGene;
+  cellControllerParams.enableInstructionShareEnergy =
+      configJsonObject.contains("enableInstructionShareEnergy")
+          ? configJsonObject["enableInstructionShareEnergy"].toBool()
+          : cellControllerParams.enableInstructionShareEnergy;
+  cellControllerParams.enableInstructionTouch =
+      configJsonObject.contains("enableInstructionTouch")
+          ? configJsonObject["enableInstructionTouch"].toBool()
+          : cellControllerParams.enableInstructionTouch;
+  cellControllerParams.enableInstructionDetermineEnergyLevel =
+      configJsonObject.contains("enableInstructionDetermineEnergyLevel")
+          ? configJsonObject["enableInstructionDetermineEnergyLevel"].toBool()
+          : cellControllerParams.enableInstructionDetermineEnergyLevel;
+  cellControllerParams.enableInstructionDetermineDepth =
+      configJsonObject.contains("enableInstructionDetermineDepth")
+          ? configJsonObject["enableInstructionDetermineDepth"].toBool()
+          : cellControllerParams.enableInstructionDetermineDepth;
+  cellControllerParams.enableInstructionDetermineBurstOfPhotosynthesisEnergy =
+      configJsonObject.contains("enableInstructionDetermineBurstOfPhotosynthesisEnergy")
+          ? configJsonObject["enableInstructionDetermineBurstOfPhotosynthesisEnergy"].toBool()
+          : cellControllerParams.enableInstructionDetermineBurstOfPhotosynthesisEnergy;
+  cellControllerParams.enableInstructionDetermineBurstOfMinerals =
+      configJsonObject.contains("enableInstructionDetermineBurstOfMinerals")
+          ? configJsonObject["enableInstructionDetermineBurstOfMinerals"].toBool()
+          : cellControllerParams.enableInstructionDetermineBurstOfMinerals;
+  cellControllerParams.enableInstructionDetermineBurstOfMineralEnergy =
+      configJsonObject.contains("enableInstructionDetermineBurstOfMineralEnergy")
+          ? configJsonObject["enableInstructionDetermineBurstOfMineralEnergy"].toBool()
+          : cellControllerParams.enableInstructionDetermineBurstOfMineralEnergy;
+  cellControllerParams.enableZeroEnergyOrganic =
+      configJsonObject.contains("enableZeroEnergyOrganic")
+          ? configJsonObject["enableZeroEnergyOrganic"].toBool()
+          : cellControllerParams.enableZeroEnergyOrganic;
+  cellControllerParams.enableForcedBuddingOnMaximalEnergyLevel =
+      configJsonObject.contains("enableForcedBuddingOnMaximalEnergyLevel")
+          ? configJsonObject["enableForcedBuddingOnMaximalEnergyLevel"].toBool()
+          : cellControllerParams.enableForcedBuddingOnMaximalEnergyLevel;
+  cellControllerParams.enableTryingToBudInUnoccupiedDirection =
+      configJsonObject.contains("enableTryingToBudInUnoccupiedDirection")
+          ? configJsonObject["enableTryingToBudInUnoccupiedDirection"].toBool()
+          : cellControllerParams.enableTryingToBudInUnoccupiedDirection;
+  cellControllerParams.enableDeathOnBuddingIfNotEnoughSpace =
+      configJsonObject.contains("enableDeathOnBuddingIfNotEnoughSpace")
+          ? configJsonObject["enableDeathOnBuddingIfNotEnoughSpace"].toBool()
+          : cellControllerParams.enableDeathOnBuddingIfNotEnoughSpace;
+  cellControllerParams.enableSeasons  = configJsonObject.contains("enableSeasons")
+                                            ? configJsonObject["enableSeasons"].toBool()
+                                            : cellControllerParams.enableSeasons;
+  cellControllerParams.enableDaytimes = configJsonObject.contains("enableDaytimes")
+                                            ? configJsonObject["enableDaytimes"].toBool()
+                                            : cellControllerParams.enableDaytimes;
+  cellControllerParams.enableMaximizingFoodEnergy =
+      configJsonObject.contains("enableMaximizingFoodEnergy")
+          ? configJsonObject["enableMaximizingFoodEnergy"].toBool()
+          : cellControllerParams.enableMaximizingFoodEnergy;
+  cellControllerParams.enableDeadCellPinningOnSinking =
+      configJsonObject.contains("enableDeadCellPinningOnSinking")
+          ? configJsonObject["enableDeadCellPinningOnSinking"].toBool()
+          : cellControllerParams.enableDeadCellPinningOnSinking;
+  if (configJsonObject.contains("firstCellGenome")) {
+    QJsonArray       firstCellGenomeArray = configJsonObject["firstCellGenome"].toArray();
+    std::vector<int> firstCellGenome;
+    for (QJsonValueRef &&firstCellGenomeInstruction : firstCellGenomeArray) {
+      firstCellGenome.push_back(firstCellGenomeInstruction.toInt());
+
+      // Genes must be in [0, genomeSize) like mutated ones so they can be stored packed
+      if (firstCellGenome.back() < 0 || firstCellGenome.back() >= cellControllerParams.genomeSize) {
+        std::cout << "error: firstCellGenome genes must be in range [0, genomeSize)" << std::endl;
+        return -1;
+      }
+    }
+    cellControllerParams.firstCellGenome = firstCellGenome;
+  }
+  cellControllerParams.firstCellEnergyMultiplier =
+      configJsonObject.contains("firstCellEnergyMultiplier")
+          ? static_cast<float>(configJsonObject["firstCellEnergyMultiplier"].toDouble())
+          : cellControllerParams.firstCellEnergyMultiplier;
+  cellControllerParams.firstCellDirection = configJsonObject.contains("firstCellDirection")
+                                                ? configJsonObject["firstCellDirection"].toInt()
+                                                : cellControllerParams.firstCellDirection;
+  cellControllerParams.firstCellIndexMultiplier =
+      configJsonObject.contains("firstCellIndexMultiplier")
+          ? static_cast<float>(configJsonObject["firstCellIndexMultiplier"].toDouble())
+          : cellControllerParams.firstCellIndexMultiplier;
+  cellControllerParams.genomeInterpreter = configJsonObject.contains("genomeInterpreter")
+                                               ? static_cast<cellarium::GenomeInterpreters>(
+                                                     configJsonObject["genomeInterpreter"].toInt())
+                                               : cellControllerParams.genomeInterpreter;
+  cellControllerParams.threadCount       = configJsonObject.contains("threadCount")
+                                               ? configJsonObject["threadCount"].toInt()
+                                               : cellControllerParams.threadCount;
+  cellControllerParams.tileWidth         = configJsonObject.contains("tileWidth")
+                                               ? configJsonObject["tileWidth"].toInt()
+                                               : cellControllerParams.tileWidth;
+  cellControllerParams.tileHeight        = configJsonObject.contains("tileHeight")
+                                               ? configJsonObject["tileHeight"].toInt()
+                                               : cellControllerParams.tileHeight;
+
+  return 0;
+}
@@ -0,0 +1,24 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef CONFIGURATION_HPP
+#define CONFIGURATION_HPP
+
+// Qt
+#include <QJsonObject>
+#include <QString>
+
+// CellController
+#include "./cell_controller.hpp"
+
+// Reads configuration file to JSON object
+int readConfigurationFile(const QString &filename, QJsonObject &configJsonObject);
+
+// Updates CellController::Params with values of JSON object (absent values are left unchanged)
+int loadCellControllerParams(const QJsonObject                 &configJsonObject,
+                             cellarium::CellController::Params &cellControllerParams);
+
+#endif
@@ -9,8 +9,12 @@
 
 // STD
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <vector>
 
 // Dear ImGui
 #include <dear_imgui/imgui.h>
@@ -77,6 +81,16 @@ void processUserInput(GLFWwindow *window, Controls &controls) {
     }
   }
 
+  // Toggling texture rendering flag
+  if (glfwGetKey(window, GLFW_KEY_T) == GLFW_PRESS) {
+    released = false;
+    if (!sPressed) {
+      sPressed = true;
+
+      controls.enableTextureRendering = !controls.enableTextureRendering;
+    }
+  }
+
   // Toggling rendering flag
   if (glfwGetKey(window, GLFW_KEY_R) == GLFW_PRESS) {
     released = false;
@@ -200,17 +214,13 @@ void mouseButtonCallback(GLFWwindow *window, int button, int action, int mods) {
     int width = 0, height = 0;
     glfwGetWindowSize(window, &width, &height);
 
-    // Getting selected cell
+    // Selecting cell before the next tick (it is copied to frames while it exists)
     Controls *controls = static_cast<Controls *>(glfwGetWindowUserPointer(window));
 
-    const int columns = controls->cellControllerPtr->getColumns();
-    const int rows    = controls->cellControllerPtr->getRows();
-    const int column  = static_cast<int>(columns * xpos / width);
-    const int row     = static_cast<int>(rows * ypos / height);
+    const int column = static_cast<int>(controls->columns * xpos / width);
+    const int row    = static_cast<int>(controls->rows * ypos / height);
 
-    if (controls->cellControllerPtr->selectCell(column, row)) {
-      controls->selectedCell = *controls->cellControllerPtr->getSelectedCell();
-    }
+    controls->simulationThreadPtr->selectCell(column, row);
   }
 }
 
@@ -233,10 +243,7 @@ void terminateDearImGui() {
 }
 
 // Processes statistics section in Dear ImGui window
-void processStatistics(const cellarium::CellController &cellController) {
-  // Getting CellController statistics
-  cellarium::CellController::Statistics statistics = cellController.getSimulationStatistics();
-
+void processStatistics(const cellarium::CellController::Statistics &statistics) {
   // Static variables for FPS and TPS counters
   static int sFrameCount = 0;
   static int sFps        = 0;
@@ -297,6 +304,79 @@ void processStatistics(const cellarium::CellController &cellController) {
   ImGui::Text("Count of mineral energy bursts:            %ld",
               statistics.countOfMineralEnergyBursts);
   ImGui::Text("Count of food energy bursts:               %ld", statistics.countOfFoodEnergyBursts);
+
+#ifdef CELLARIUM_PROFILING
+  // Profiled instruction and handler names
+  static constexpr std::array<const char *, cellarium::kProfiledInstructionCount> kInstructionNames{
+      "Do nothing",
+      "Turn",
+      "Move",
+      "Get energy from photosynthesis",
+      "Get energy from minerals",
+      "Get energy from food",
+      "Bud",
+      "Mutate random gene",
+      "Share energy",
+      "Touch",
+      "Determine energy level",
+      "Determine depth",
+      "Determine burst of photosynthesis energy",
+      "Determine burst of minerals",
+      "Determine burst of mineral energy",
+      "Unconditional jump",
+  };
+  static constexpr std::array<const char *, static_cast<int>(cellarium::ProfiledHandlers::Size)>
+      kHandlerNames{
+          "Move",
+          "Get energy from food",
+          "Bud",
+          "Touch",
+      };
+
+  // Profile
+  ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "Profile");
+
+  // Adding counts of executed instructions and of instructions reaching instructions per tick limit
+  ImGui::BeginTable("Instructions", 3);
+  ImGui::TableNextColumn();
+  ImGui::Text("Instruction");
+  ImGui::TableNextColumn();
+  ImGui::Text("Executed");
+  ImGui::TableNextColumn();
+  ImGui::Text("Reached limit");
+  for (int i = 0; i < cellarium::kProfiledInstructionCount; ++i) {
+    ImGui::TableNextColumn();
+    ImGui::Text("%s", kInstructionNames[i]);
+    ImGui::TableNextColumn();
+    ImGui::Text("%ld", statistics.profile.instructionCounts[i]);
+    ImGui::TableNextColumn();
+    ImGui::Text("%ld", statistics.profile.instructionLimitCounts[i]);
+  }
+  ImGui::EndTable();
+
+  // Adding counts of handler calls and mean cycles of sampled ones
+  ImGui::BeginTable("Handlers", 3);
+  ImGui::TableNextColumn();
+  ImGui::Text("Handler");
+  ImGui::TableNextColumn();
+  ImGui::Text("Calls");
+  ImGui::TableNextColumn();
+  ImGui::Text("Cycles per call");
+  for (int i = 0; i < static_cast<int>(cellarium::ProfiledHandlers::Size); ++i) {
+    const long sampleCount = statistics.profile.handlerSampleCounts[i];
+
+    ImGui::TableNextColumn();
+    ImGui::Text("%s", kHandlerNames[i]);
+    ImGui::TableNextColumn();
+    ImGui::Text("%ld", statistics.profile.handlerCallCounts[i]);
+    ImGui::TableNextColumn();
+    ImGui::Text("%.1f",
+                sampleCount > 0 ? static_cast<double>(statistics.profile.handlerSampleCycles[i]) /
+                                      static_cast<double>(sampleCount)
+                                : 0.0);
+  }
+  ImGui::EndTable();
+#endif
 }
 
 // Processes controls section in Dear ImGui window
@@ -350,6 +430,13 @@ void processControls(GLFWwindow *window, Controls &controls) {
     controls.enableRenderingEnvironment = !controls.enableRenderingEnvironment;
   }
 
+  // Toggling texture rendering flag
+  ImGui::Text("Texture rendering flag: %d", controls.enableTextureRendering);
+  ImGui::SameLine(buttonHorizontalOffset);
+  if (ImGui::Button("Toggle (Texture rendering flag)", {kButtonWidth, 0.0f})) {
+    controls.enableTextureRendering = !controls.enableTextureRendering;
+  }
+
   // Toggling pause flag
   ImGui::Text("Pause flag: %d", controls.enablePause);
   ImGui::SameLine(buttonHorizontalOffset);
@@ -390,8 +477,39 @@ void processControls(GLFWwindow *window, Controls &controls) {
   }
 }
 
-// Processes simulation parameters section in Dear ImGui window (CellController friend function)
-void cellarium::processSimulationParameters(cellarium::CellController &cellController) {
+// Processes simulation parameters section in Dear ImGui window changing given parameters
+// (genome size and count of rows limit some of them)
+void processSimulationParameters(cellarium::SnapshotParameters &parameters, int genomeSize,
+                                 int rows) {
+  // Enabling flag names in bit order (see cellarium::SnapshotParameters::enablingFlags)
+  static constexpr std::array<const char *, cellarium::kSnapshotEnablingFlagCount>
+      kEnablingFlagNames{
+          "Turn",
+          "Move",
+          "Get energy from photosynthesis",
+          "Get energy from minerals",
+          "Get energy from food",
+          "Bud",
+          "Mutate random gene",
+          "Share energy",
+          "Touch",
+          "Determine energy level",
+          "Determine depth",
+          "Determine burst of photosynthesis energy",
+          "Determine burst of minerals",
+          "Determine burst of mineral energy",
+          "Zero energy organic",
+          "Forced budding on maximal energy level",
+          "Trying to bud in unoccupied direction",
+          "Death on budding if not enough space",
+          "Seasons",
+          "Daytimes",
+          "Maximizing food energy",
+          "Dead cell pinning on sinking",
+      };
+  // Index of the first simulation rule enabling flag (previous ones are instruction ones)
+  static constexpr int kFirstRuleEnablingFlag = 14;
+
   // Constant
   static constexpr int   kBigNumber   = 1000;
   static constexpr float kButtonWidth = 50.0f;
@@ -401,284 +519,153 @@ void cellarium::processSimulationParameters(cellarium::CellController &cellContr
   ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f),
                      "Genome machine and simulation environment properties");
 
-  // _maxInstructionsPerTick
+  // maxInstructionsPerTick
   ImGui::Text("Max instructions per tick: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderInt(" Slider (Max instructions per tick)", &cellController._maxInstructionsPerTick,
-                   1, cellController._genomeSize);
-  // _maxAkinGenomDifference
+  ImGui::SliderInt(" Slider (Max instructions per tick)", &parameters.maxInstructionsPerTick, 1,
+                   genomeSize);
+  // maxAkinGenomDifference
   ImGui::Text("Max akin genom difference: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderInt(" Slider (Max akin genom difference)", &cellController._maxAkinGenomDifference,
-                   0, cellController._genomeSize);
-  // _minChildEnergy
+  ImGui::SliderInt(" Slider (Max akin genom difference)", &parameters.maxAkinGenomDifference, 0,
+                   genomeSize);
+  // minChildEnergy
   ImGui::Text("Min child energy: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderInt(" Slider (Min child energy)", &cellController._minChildEnergy, 1,
-                   cellController._maxEnergy);
-  // _maxEnergy
+  ImGui::SliderInt(" Slider (Min child energy)", &parameters.minChildEnergy, 1,
+                   parameters.maxEnergy);
+  // maxEnergy
   ImGui::Text("Max energy: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderInt(" Slider (Max energy)", &cellController._maxEnergy, 2, kBigNumber);
-  // _maxBurstOfPhotosynthesisEnergy
+  ImGui::SliderInt(" Slider (Max energy)", &parameters.maxEnergy, 2, kBigNumber);
+  // maxBurstOfPhotosynthesisEnergy
   ImGui::Text("Max burst of photosynthesis energy: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
   ImGui::SliderInt(" Slider (Max burst of photosynthesis energy)",
-                   &cellController._maxBurstOfPhotosynthesisEnergy, 0, cellController._maxEnergy);
-  // _maxPhotosynthesisDepth
+                   &parameters.maxBurstOfPhotosynthesisEnergy, 0, parameters.maxEnergy);
+  // maxPhotosynthesisDepth
   ImGui::Text("Max photosynthesis depth: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderInt(" Slider (Max photosynthesis depth)", &cellController._maxPhotosynthesisDepth, 0,
-                   cellController._rows);
-  // _summerDaytimeToWholeDayRatio
+  ImGui::SliderInt(" Slider (Max photosynthesis depth)", &parameters.maxPhotosynthesisDepth, 0,
+                   rows);
+  // summerDaytimeToWholeDayRatio
   ImGui::Text("Summer daytime to whole day ratio: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
   ImGui::SliderFloat(" Slider (Summer daytime to whole day ratio)",
-                     &cellController._summerDaytimeToWholeDayRatio, 0.0f, 1.0f);
-  // _maxMinerals
+                     &parameters.summerDaytimeToWholeDayRatio, 0.0f, 1.0f);
+  // maxMinerals
   ImGui::Text("Max minerals: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderInt(" Slider (Max minerals)", &cellController._maxMinerals, 0,
-                   cellController._maxEnergy);
-  // _maxBurstOfMinerals
+  ImGui::SliderInt(" Slider (Max minerals)", &parameters.maxMinerals, 0, parameters.maxEnergy);
+  // maxBurstOfMinerals
   ImGui::Text("Max burst of minerals: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderInt(" Slider (Max burst of minerals)", &cellController._maxBurstOfMinerals, 0,
-                   cellController._maxMinerals);
-  // _energyPerMineral
+  ImGui::SliderInt(" Slider (Max burst of minerals)", &parameters.maxBurstOfMinerals, 0,
+                   parameters.maxMinerals);
+  // energyPerMineral
   ImGui::Text("Energy per mineral: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderFloat(" Slider (Energy per mineral)", &cellController._energyPerMineral, 0.0f,
-                     static_cast<float>(cellController._maxEnergy));
-  // _maxMineralHeight
+  ImGui::SliderFloat(" Slider (Energy per mineral)", &parameters.energyPerMineral, 0.0f,
+                     static_cast<float>(parameters.maxEnergy));
+  // maxMineralHeight
   ImGui::Text("Max mineral height: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderInt(" Slider (Max mineral height)", &cellController._maxMineralHeight, 0,
-                   cellController._rows);
-  // _maxBurstOfFoodEnergy
+  ImGui::SliderInt(" Slider (Max mineral height)", &parameters.maxMineralHeight, 0, rows);
+  // maxBurstOfFoodEnergy
   ImGui::Text("Max burst of food energy: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderInt(" Slider (Max burst of food energy)", &cellController._maxBurstOfFoodEnergy, 0,
-                   cellController._maxEnergy);
-  // _childBudMutationChance
+  ImGui::SliderInt(" Slider (Max burst of food energy)", &parameters.maxBurstOfFoodEnergy, 0,
+                   parameters.maxEnergy);
+  // childBudMutationChance
   ImGui::Text("Child bud mutation chance: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderFloat(" Slider (Child bud mutation chance)", &cellController._childBudMutationChance,
+  ImGui::SliderFloat(" Slider (Child bud mutation chance)", &parameters.childBudMutationChance,
                      0.0f, 1.0f);
-  // _parentBudMutationChance
+  // parentBudMutationChance
   ImGui::Text("Parent bud mutation chance: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderFloat(" Slider (Parent bud mutation chance)",
-                     &cellController._parentBudMutationChance, 0.0f, 1.0f);
-  // _randomMutationChance
+  ImGui::SliderFloat(" Slider (Parent bud mutation chance)", &parameters.parentBudMutationChance,
+                     0.0f, 1.0f);
+  // randomMutationChance
   ImGui::Text("Random mutation chance: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderFloat(" Slider (Random mutation chance)", &cellController._randomMutationChance,
-                     0.0f, 1.0f);
-  // _dayDurationInTicks
+  ImGui::SliderFloat(" Slider (Random mutation chance)", &parameters.randomMutationChance, 0.0f,
+                     1.0f);
+  // dayDurationInTicks
   ImGui::Text("Day duration in ticks: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderInt(" Slider (Day duration in ticks)", &cellController._dayDurationInTicks, 1,
+  ImGui::SliderInt(" Slider (Day duration in ticks)", &parameters.dayDurationInTicks, 1,
                    kBigNumber);
-  // _seasonDurationInDays
+  // seasonDurationInDays
   ImGui::Text("Season duration in days: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderInt(" Slider (Season duration in days)", &cellController._seasonDurationInDays, 1,
+  ImGui::SliderInt(" Slider (Season duration in days)", &parameters.seasonDurationInDays, 1,
                    kBigNumber);
-  // _gammaFlashPeriodInDays
+  // gammaFlashPeriodInDays
   ImGui::Text("Gamma flash period in days: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
-  ImGui::SliderInt(" Slider (Gamma flash period in days)", &cellController._gammaFlashPeriodInDays,
-                   1, kBigNumber);
-  // _gammaFlashMaxMutationsCount
+  ImGui::SliderInt(" Slider (Gamma flash period in days)", &parameters.gammaFlashPeriodInDays, 1,
+                   kBigNumber);
+  // gammaFlashMaxMutationsCount
   ImGui::Text("Gamma flash max mutations count: ");
   ImGui::SameLine(buttonHorizontalOffset);
   ImGui::SetNextItemWidth(kButtonWidth);
   ImGui::SliderInt(" Slider (Gamma flash max mutations count)",
-                   &cellController._gammaFlashMaxMutationsCount, 0, cellController._genomeSize);
-
-  // Cell genome instruction enabling flags
-  ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "Cell genome instruction enabling flags");
+                   &parameters.gammaFlashMaxMutationsCount, 0, genomeSize);
+
+  for (int i = 0; i < cellarium::kSnapshotEnablingFlagCount; ++i) {
+    // Cell genome instruction and other simulation rule enabling flags
+    if (i == 0) {
+      ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "Cell genome instruction enabling flags");
+    } else if (i == kFirstRuleEnablingFlag) {
+      ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "Other simulation rule enabling flags");
+    }
 
-  // _enableInstructionTurn
-  ImGui::Text("Turn: %d", cellController._enableInstructionTurn);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Turn)", {kButtonWidth, 0.0f})) {
-    cellController._enableInstructionTurn = !cellController._enableInstructionTurn;
-  }
-  // _enableInstructionMove
-  ImGui::Text("Move: %d", cellController._enableInstructionMove);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Move)", {kButtonWidth, 0.0f})) {
-    cellController._enableInstructionMove = !cellController._enableInstructionMove;
-  }
-  // _enableInstructionGetEnergyFromPhotosynthesis
-  ImGui::Text("Get energy from photosynthesis: %d",
-              cellController._enableInstructionGetEnergyFromPhotosynthesis);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Get energy from photosynthesis)", {kButtonWidth, 0.0f})) {
-    cellController._enableInstructionGetEnergyFromPhotosynthesis =
-        !cellController._enableInstructionGetEnergyFromPhotosynthesis;
-  }
-  // _enableInstructionGetEnergyFromMinerals
-  ImGui::Text("Get energy from minerals: %d",
-              cellController._enableInstructionGetEnergyFromMinerals);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Get energy from minerals)", {kButtonWidth, 0.0f})) {
-    cellController._enableInstructionGetEnergyFromMinerals =
-        !cellController._enableInstructionGetEnergyFromMinerals;
-  }
-  // _enableInstructionGetEnergyFromFood
-  ImGui::Text("Get energy from food: %d", cellController._enableInstructionGetEnergyFromFood);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Get energy from food)", {kButtonWidth, 0.0f})) {
-    cellController._enableInstructionGetEnergyFromFood =
-        !cellController._enableInstructionGetEnergyFromFood;
-  }
-  // _enableInstructionBud
-  ImGui::Text("Bud: %d", cellController._enableInstructionBud);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Bud)", {kButtonWidth, 0.0f})) {
-    cellController._enableInstructionBud = !cellController._enableInstructionBud;
-  }
-  // _enableInstructionMutateRandomGene
-  ImGui::Text("Mutate random gene: %d", cellController._enableInstructionMutateRandomGene);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Mutate random gene)", {kButtonWidth, 0.0f})) {
-    cellController._enableInstructionMutateRandomGene =
-        !cellController._enableInstructionMutateRandomGene;
-  }
-  // _enableInstructionShareEnergy
-  ImGui::Text("Share energy: %d", cellController._enableInstructionShareEnergy);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Share energy)", {kButtonWidth, 0.0f})) {
-    cellController._enableInstructionShareEnergy = !cellController._enableInstructionShareEnergy;
-  }
-  // _enableInstructionTouch
-  ImGui::Text("Touch: %d", cellController._enableInstructionTouch);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Touch)", {kButtonWidth, 0.0f})) {
-    cellController._enableInstructionTouch = !cellController._enableInstructionTouch;
-  }
-  // _enableInstructionDetermineEnergyLevel
-  ImGui::Text("Determine energy level: %d", cellController._enableInstructionDetermineEnergyLevel);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Determine energy level)", {kButtonWidth, 0.0f})) {
-    cellController._enableInstructionDetermineEnergyLevel =
-        !cellController._enableInstructionDetermineEnergyLevel;
-  }
-  // _enableInstructionDetermineDepth
-  ImGui::Text("Determine depth: %d", cellController._enableInstructionDetermineDepth);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Determine depth)", {kButtonWidth, 0.0f})) {
-    cellController._enableInstructionDetermineDepth =
-        !cellController._enableInstructionDetermineDepth;
-  }
-  // _enableInstructionDetermineBurstOfPhotosynthesisEnergy
-  ImGui::Text("Determine burst of photosynthesis energy: %d",
-              cellController._enableInstructionDetermineBurstOfPhotosynthesisEnergy);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Determine burst of photosynthesis energy)", {kButtonWidth, 0.0f})) {
-    cellController._enableInstructionDetermineBurstOfPhotosynthesisEnergy =
-        !cellController._enableInstructionDetermineBurstOfPhotosynthesisEnergy;
-  }
-  // _enableInstructionDetermineBurstOfMinerals
-  ImGui::Text("Determine burst of minerals: %d",
-              cellController._enableInstructionDetermineBurstOfMinerals);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Determine burst of minerals)", {kButtonWidth, 0.0f})) {
-    cellController._enableInstructionDetermineBurstOfMinerals =
-        !cellController._enableInstructionDetermineBurstOfMinerals;
-  }
-  // _enableInstructionDetermineBurstOfMineralEnergy
-  ImGui::Text("Determine burst of mineral energy: %d",
-              cellController._enableInstructionDetermineBurstOfMineralEnergy);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Determine burst of mineral energy)", {kButtonWidth, 0.0f})) {
-    cellController._enableInstructionDetermineBurstOfMineralEnergy =
-        !cellController._enableInstructionDetermineBurstOfMineralEnergy;
+    // Toggling enabling flag bit
+    const std::uint32_t flag = 1u << i;
+    ImGui::Text("%s: %d", kEnablingFlagNames[i], (parameters.enablingFlags & flag) != 0);
+    ImGui::SameLine(buttonHorizontalOffset);
+    if (ImGui::Button((std::string{"Toggle ("} + kEnablingFlagNames[i] + ")").c_str(),
+                      {kButtonWidth, 0.0f})) {
+      parameters.enablingFlags ^= flag;
+    }
   }
 
-  // Other simulation rule enabling flags
-  ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "Other simulation rule enabling flags");
+  // Genome interpreter
+  ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "Genome interpreter");
 
-  // _enableZeroEnergyOrganic
-  ImGui::Text("Zero energy organic: %d", cellController._enableZeroEnergyOrganic);
+  // genomeInterpreter
+  const bool isThreaded =
+      parameters.genomeInterpreter == static_cast<int>(cellarium::GenomeInterpreters::Threaded);
+  ImGui::Text("Threaded code: %d", isThreaded);
   ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Zero energy organic)", {kButtonWidth, 0.0f})) {
-    cellController._enableZeroEnergyOrganic = !cellController._enableZeroEnergyOrganic;
-  }
-  // _enableForcedBuddingOnMaximalEnergyLevel
-  ImGui::Text("Forced budding on maximal energy level: %d",
-              cellController._enableForcedBuddingOnMaximalEnergyLevel);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Forced budding on maximal energy level)", {kButtonWidth, 0.0f})) {
-    cellController._enableForcedBuddingOnMaximalEnergyLevel =
-        !cellController._enableForcedBuddingOnMaximalEnergyLevel;
-  }
-  // _enableTryingToBudInUnoccupiedDirection
-  ImGui::Text("Trying to bud in unoccupied direction: %d",
-              cellController._enableTryingToBudInUnoccupiedDirection);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Trying to bud in unoccupied direction)", {kButtonWidth, 0.0f})) {
-    cellController._enableTryingToBudInUnoccupiedDirection =
-        !cellController._enableTryingToBudInUnoccupiedDirection;
-  }
-  // _enableDeathOnBuddingIfNotEnoughSpace
-  ImGui::Text("Death on budding if not enough space: %d",
-              cellController._enableDeathOnBuddingIfNotEnoughSpace);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Death on budding if not enough space)", {kButtonWidth, 0.0f})) {
-    cellController._enableDeathOnBuddingIfNotEnoughSpace =
-        !cellController._enableDeathOnBuddingIfNotEnoughSpace;
-  }
-  // _enableSeasons
-  ImGui::Text("Seasons: %d", cellController._enableSeasons);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Seasons)", {kButtonWidth, 0.0f})) {
-    cellController._enableSeasons = !cellController._enableSeasons;
-  }
-  // _enableDaytimes
-  ImGui::Text("Daytimes: %d", cellController._enableDaytimes);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Daytimes)", {kButtonWidth, 0.0f})) {
-    cellController._enableDaytimes = !cellController._enableDaytimes;
-  }
-  // _enableMaximizingFoodEnergy
-  ImGui::Text("Maximizing food energy: %d", cellController._enableMaximizingFoodEnergy);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Maximizing food energy)", {kButtonWidth, 0.0f})) {
-    cellController._enableMaximizingFoodEnergy = !cellController._enableMaximizingFoodEnergy;
-  }
-  // _enableDeadCellPinningOnSinking
-  ImGui::Text("Dead cell pinning on sinking: %d", cellController._enableDeadCellPinningOnSinking);
-  ImGui::SameLine(buttonHorizontalOffset);
-  if (ImGui::Button("Toggle (Dead cell pinning on sinking)", {kButtonWidth, 0.0f})) {
-    cellController._enableDeadCellPinningOnSinking =
-        !cellController._enableDeadCellPinningOnSinking;
+  if (ImGui::Button("Toggle (Threaded code)", {kButtonWidth, 0.0f})) {
+    parameters.genomeInterpreter =
+        static_cast<int>(isThreaded ? cellarium::GenomeInterpreters::Switch
+                                    : cellarium::GenomeInterpreters::Threaded);
   }
 }
 
 // Processes cell overview section in Dear ImGui window
-void cellarium::processCellOverview(Cell &cell, bool selectedCellExists) {
+void processCellOverview(cellarium::Cell &cell, bool selectedCellExists) {
   // Constant
   static constexpr float kButtonWidth = 50.0f;
   const float buttonHorizontalOffset  = ImGui::GetWindowContentRegionWidth() - kButtonWidth;
@@ -687,7 +674,8 @@ void cellarium::processCellOverview(Cell &cell, bool selectedCellExists) {
   ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "Cell overview");
 
   // Adding cell properties
-  const int genomSize = static_cast<int>(cell._genome.size());
+  const std::vector<int> &genome    = cell.getGenome();
+  const int               genomSize = static_cast<int>(genome.size());
   if (genomSize > 0) {
     const int columns = static_cast<int>(std::sqrt(genomSize));
     const int rows =
@@ -697,24 +685,24 @@ void cellarium::processCellOverview(Cell &cell, bool selectedCellExists) {
     for (int c = 0; c < columns; ++c) {
       ImGui::TableNextColumn();
       for (int r = 0; r < rows; ++r) {
-        ImGui::Text("%d", cell._genome[r * columns + c]);
+        ImGui::Text("%d", genome[r * columns + c]);
       }
     }
     ImGui::EndTable();
   }
-  ImGui::Text("Command counter:                           %d", cell._counter);
-  ImGui::Text("Energy:                                    %d", cell._energy);
-  ImGui::Text("Minerals:                                  %d", cell._minerals);
-  ImGui::Text("Index:                                     %d", cell._index);
-  ImGui::Text("Direction:                                 %d", cell._direction);
-  ImGui::Text("Age:                                       %d", cell._age);
-  ImGui::Text("Count of food energy bursts:               %d", cell._colorR);
-  ImGui::Text("Count of photosynthesis energy bursts:     %d", cell._colorG);
-  ImGui::Text("Count of mineral energy bursts:            %d", cell._colorB);
-  ImGui::Text("Energy share balance:                      %d", cell._energyShareBalance);
-  ImGui::Text("Last energy share:                         %f", cell._lastEnergyShare);
-  ImGui::Text("Is alive:                                  %d", cell._isAlive);
-  ImGui::Text("Is pinned:                                 %d", cell._isPinned);
+  ImGui::Text("Command counter:                           %d", cell.getCounter());
+  ImGui::Text("Energy:                                    %d", cell.getEnergy());
+  ImGui::Text("Minerals:                                  %d", cell.getMinerals());
+  ImGui::Text("Index:                                     %d", cell.getIndex());
+  ImGui::Text("Direction:                                 %d", cell.getDirection());
+  ImGui::Text("Age:                                       %d", cell.getAge());
+  ImGui::Text("Count of food energy bursts:               %d", cell.getColorR());
+  ImGui::Text("Count of photosynthesis energy bursts:     %d", cell.getColorG());
+  ImGui::Text("Count of mineral energy bursts:            %d", cell.getColorB());
+  ImGui::Text("Energy share balance:                      %d", cell.getEnergyShareBalance());
+  ImGui::Text("Last energy share:                         %f", cell.getLastEnergyShare());
+  ImGui::Text("Is alive:                                  %d", cell.isAlive());
+  ImGui::Text("Is pinned:                                 %d", cell.isPinned());
 
   if (!selectedCellExists) {
     ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "Selected cell does not exist anymore: ");
@@ -725,8 +713,8 @@ void cellarium::processCellOverview(Cell &cell, bool selectedCellExists) {
   }
 }
 
-// Processes Dear ImGui windows
-void processDearImGui(GLFWwindow *window, Controls &controls) {
+// Processes Dear ImGui windows with statistics and selected cell of given frame
+void processDearImGui(GLFWwindow *window, Controls &controls, const SimulationFrame &frame) {
   // Preparing Dear ImGui for the new frame
   ImGui_ImplGlfw_NewFrame();
   ImGui_ImplOpenGL3_NewFrame();
@@ -754,7 +742,7 @@ void processDearImGui(GLFWwindow *window, Controls &controls) {
 
     // Processing statistics section
     ImGui::BeginChild("Statistics", childSize, true);
-    processStatistics(*controls.cellControllerPtr);
+    processStatistics(frame.statistics);
     ImGui::EndChild();
 
     // Processing controls section
@@ -763,20 +751,23 @@ void processDearImGui(GLFWwindow *window, Controls &controls) {
     processControls(window, controls);
     ImGui::EndChild();
 
-    // Processing simulation parameters section
+    // Processing simulation parameters section and queuing changed parameters
     ImGui::BeginChild("Simulation parameters", childSize, true);
-    cellarium::processSimulationParameters(*controls.cellControllerPtr);
+    const cellarium::SnapshotParameters prevParameters{controls.parameters};
+    processSimulationParameters(controls.parameters, controls.genomeSize, controls.rows);
+    if (std::memcmp(&prevParameters, &controls.parameters, sizeof(cellarium::SnapshotParameters)) !=
+        0) {
+      controls.simulationThreadPtr->setParameters(controls.parameters);
+    }
     ImGui::EndChild();
 
     // Processing genom overview section
     ImGui::SameLine(0.0f, kBorderOffset);
     ImGui::BeginChild("Cell overview", childSize, true);
-    const cellarium::Cell *selectedCellPtr    = controls.cellControllerPtr->getSelectedCell();
-    bool                   selectedCellExists = selectedCellPtr != nullptr;
-    if (selectedCellExists) {
-      controls.selectedCell = *selectedCellPtr;
+    if (frame.selectedCellExists) {
+      controls.selectedCell = frame.selectedCell;
     }
-    cellarium::processCellOverview(controls.selectedCell, selectedCellExists);
+    processCellOverview(controls.selectedCell, frame.selectedCellExists);
     ImGui::EndChild();
 
     ImGui::End();
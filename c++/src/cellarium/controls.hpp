@@ -7,6 +7,9 @@
 #ifndef CONTROLS_HPP
 #define CONTROLS_HPP
 
+// STD
+#include <string>
+
 // OpenGL
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
@@ -14,6 +17,9 @@
 // CellController
 #include "./cell_controller.hpp"
 
+// SimulationThread
+#include "./simulation_thread.hpp"
+
 // Struct with controls variables
 struct Controls {
   int  cellRenderingMode{};
@@ -21,6 +27,7 @@ struct Controls {
 
   bool enableRendering{};
   bool enableRenderingEnvironment{};
+  bool enableTextureRendering{};
   bool enablePause{};
   bool enableFullscreenMode{};
   bool enableVSync{};
@@ -28,8 +35,16 @@ struct Controls {
 
   bool tickRequest{};
 
-  cellarium::CellController *cellControllerPtr{};
-  cellarium::Cell            selectedCell{};
+  // Replay log recorded while simulation runs (empty if it is not recorded)
+  std::string replayLogFilename{};
+
+  // Simulation thread, world size and parameters edited in GUI (they are queued when changed)
+  SimulationThread             *simulationThreadPtr{};
+  int                           columns{};
+  int                           rows{};
+  int                           genomeSize{};
+  cellarium::SnapshotParameters parameters{};
+  cellarium::Cell               selectedCell{};
 };
 
 // User input processing function
@@ -47,7 +62,7 @@ void initDearImGui(GLFWwindow *window);
 // Terminates Dear ImGui context
 void terminateDearImGui();
 
-// Processes Dear ImGui windows
-void processDearImGui(GLFWwindow *window, Controls &controls);
+// Processes Dear ImGui windows with statistics and selected cell of given frame
+void processDearImGui(GLFWwindow *window, Controls &controls, const SimulationFrame &frame);
 
 #endif
@@ -0,0 +1,143 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Header file
+#include "./genome_arena.hpp"
+
+// STD
+#include <cstring>
+#include <utility>
+
+// Using header file namespace
+using namespace cellarium;
+
+GenomeArena::GenomeArena() noexcept {}
+
+GenomeArena::GenomeArena(int genomeSize, bool isPacked)
+    : _genomeSize{genomeSize}, _isPacked{isPacked} {}
+
+GenomeArena::GenomeArena(const GenomeArena &genomeArena)
+    : _genomeSize{genomeArena._genomeSize},
+      _isPacked{genomeArena._isPacked},
+      _packedGenes{genomeArena._packedGenes},
+      _genes{genomeArena._genes},
+      _freeSlots{genomeArena._freeSlots},
+      _slotCount{genomeArena._slotCount} {}
+
+GenomeArena &GenomeArena::operator=(const GenomeArena &genomeArena) {
+  _genomeSize  = genomeArena._genomeSize;
+  _isPacked    = genomeArena._isPacked;
+  _packedGenes = genomeArena._packedGenes;
+  _genes       = genomeArena._genes;
+  _freeSlots   = genomeArena._freeSlots;
+  _slotCount   = genomeArena._slotCount;
+
+  return *this;
+}
+
+GenomeArena::GenomeArena(GenomeArena &&genomeArena) noexcept
+    : _genomeSize{std::exchange(genomeArena._genomeSize, 0)},
+      _isPacked{std::exchange(genomeArena._isPacked, false)},
+      _packedGenes{std::exchange(genomeArena._packedGenes, std::vector<std::uint8_t>{})},
+      _genes{std::exchange(genomeArena._genes, std::vector<int>{})},
+      _freeSlots{std::exchange(genomeArena._freeSlots, std::vector<int>{})},
+      _slotCount{std::exchange(genomeArena._slotCount, 0)} {}
+
+GenomeArena &GenomeArena::operator=(GenomeArena &&genomeArena) noexcept {
+  std::swap(_genomeSize, genomeArena._genomeSize);
+  std::swap(_isPacked, genomeArena._isPacked);
+  std::swap(_packedGenes, genomeArena._packedGenes);
+  std::swap(_genes, genomeArena._genes);
+  std::swap(_freeSlots, genomeArena._freeSlots);
+  std::swap(_slotCount, genomeArena._slotCount);
+
+  return *this;
+}
+
+GenomeArena::~GenomeArena() noexcept {}
+
+int GenomeArena::allocate() {
+  // Reusing the last released slot if there is one
+  if (!_freeSlots.empty()) {
+    const int slot = _freeSlots.back();
+    _freeSlots.pop_back();
+    return slot;
+  }
+
+  // Growing the pool by one slot (vector growth keeps it amortized)
+  const size_t geneCount = static_cast<size_t>(_slotCount + 1) * _genomeSize;
+  if (_isPacked) {
+    _packedGenes.resize(geneCount);
+  } else {
+    _genes.resize(geneCount);
+  }
+  return _slotCount++;
+}
+
+int GenomeArena::copy(int slot) {
+  // Allocating first because growth invalidates pointers to genes
+  const int newSlot = allocate();
+
+  const size_t offset    = static_cast<size_t>(slot) * _genomeSize;
+  const size_t newOffset = static_cast<size_t>(newSlot) * _genomeSize;
+  if (_isPacked) {
+    std::memcpy(&_packedGenes[newOffset], &_packedGenes[offset], _genomeSize);
+  } else {
+    std::memcpy(&_genes[newOffset], &_genes[offset], _genomeSize * sizeof(int));
+  }
+
+  return newSlot;
+}
+
+void GenomeArena::release(int slot) { _freeSlots.push_back(slot); }
+
+void GenomeArena::reserve(int freeSlotCount) {
+  // Calculating count of missing slots
+  const int newSlotCount = freeSlotCount - static_cast<int>(_freeSlots.size());
+  if (newSlotCount <= 0) {
+    return;
+  }
+
+  // Growing the pool by all missing slots at once
+  const size_t geneCount = static_cast<size_t>(_slotCount + newSlotCount) * _genomeSize;
+  if (_isPacked) {
+    _packedGenes.resize(geneCount);
+  } else {
+    _genes.resize(geneCount);
+  }
+
+  // Making new slots free (in reverse order so they are allocated in ascending order)
+  for (int slot = _slotCount + newSlotCount - 1; slot >= _slotCount; --slot) {
+    _freeSlots.push_back(slot);
+  }
+  _slotCount += newSlotCount;
+}
+
+int GenomeArena::getGene(int slot, int gene) const noexcept {
+  const size_t offset = static_cast<size_t>(slot) * _genomeSize + gene;
+  return _isPacked ? _packedGenes[offset] : _genes[offset];
+}
+
+void GenomeArena::setGene(int slot, int gene, int value) noexcept {
+  const size_t offset = static_cast<size_t>(slot) * _genomeSize + gene;
+  if (_isPacked) {
+    _packedGenes[offset] = static_cast<std::uint8_t>(value);
+  } else {
+    _genes[offset] = value;
+  }
+}
+
+const std::uint8_t *GenomeArena::getPackedGenome(int slot) const noexcept {
+  return &_packedGenes[static_cast<size_t>(slot) * _genomeSize];
+}
+
+const int *GenomeArena::getGenome(int slot) const noexcept {
+  return &_genes[static_cast<size_t>(slot) * _genomeSize];
+}
+
+int GenomeArena::getGenomeSize() const noexcept { return _genomeSize; }
+
+bool GenomeArena::isPacked() const noexcept { return _isPacked; }
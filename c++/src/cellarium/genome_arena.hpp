@@ -0,0 +1,66 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef GENOME_ARENA_HPP
+#define GENOME_ARENA_HPP
+
+// STD
+#include <cstdint>
+#include <vector>
+
+namespace cellarium {
+
+// Maximal gene value which can be stored in packed (8-bit) form
+static constexpr int kMaxPackedGene = 255;
+
+// Class for storing genomes of the same size in one pool with recycling of released slots
+class GenomeArena {
+ private:
+  int  _genomeSize{};
+  bool _isPacked{};
+
+  // Genes of all slots stored contiguously with genome size stride
+  // (only one of the vectors is used depending on whether genes are packed)
+  std::vector<std::uint8_t> _packedGenes{};
+  std::vector<int>          _genes{};
+  // Released slots available for reuse
+  std::vector<int>          _freeSlots{};
+
+  int _slotCount{};
+
+ public:
+  GenomeArena() noexcept;
+  GenomeArena(int genomeSize, bool isPacked);
+  GenomeArena(const GenomeArena &genomeArena);
+  GenomeArena &operator=(const GenomeArena &genomeArena);
+  GenomeArena(GenomeArena &&genomeArena) noexcept;
+  GenomeArena &operator=(GenomeArena &&genomeArena) noexcept;
+  ~GenomeArena() noexcept;
+
+  // Returns a free slot (genes are not initialized)
+  int allocate();
+  // Returns a free slot with genes copied from given slot
+  int copy(int slot);
+  // Makes slot available for reuse
+  void release(int slot);
+  // Grows the pool so that given count of slots can be allocated without further growth
+  void reserve(int freeSlotCount);
+
+  // Gets and sets slot genome gene (value must fit in 8 bits if genes are packed)
+  int  getGene(int slot, int gene) const noexcept;
+  void setGene(int slot, int gene, int value) noexcept;
+
+  // Return pointers to the first gene of slot genome in packed and unpacked form
+  const std::uint8_t *getPackedGenome(int slot) const noexcept;
+  const int          *getGenome(int slot) const noexcept;
+
+  int  getGenomeSize() const noexcept;
+  bool isPacked() const noexcept;
+};
+
+}
+
+#endif
@@ -0,0 +1,169 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Header file
+#include "./genome_comparison.hpp"
+
+// SIMD (SSE2 is a part of x86-64 baseline, AVX2 is enabled per function and checked at runtime)
+#if defined(__x86_64__) || defined(_M_X64)
+#define CELLARIUM_GENOME_COMPARISON_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define CELLARIUM_GENOME_COMPARISON_AVX2
+#include <immintrin.h>
+#endif
+#endif
+
+// Using header file namespace
+using namespace cellarium;
+
+// Returns number of set bits (loops only over mismatches which are few in akin genomes)
+static int countBits(unsigned int bits) noexcept {
+  int count{};
+
+  while (bits != 0) {
+    bits &= bits - 1;
+    ++count;
+  }
+
+  return count;
+}
+
+// Compares genomes gene by gene exiting as soon as difference exceeds maxDifference
+static bool arePackedGenomesAkinScalar(const std::uint8_t *genome1, const std::uint8_t *genome2,
+                                       int genomeSize, int maxDifference) noexcept {
+  int diff{};
+
+  for (int i = 0; i < genomeSize; ++i) {
+    if (genome1[i] != genome2[i]) {
+      ++diff;
+      if (diff > maxDifference) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+#ifdef CELLARIUM_GENOME_COMPARISON_SSE2
+// Compares genomes 16 genes at a time exiting as soon as difference exceeds maxDifference
+static bool arePackedGenomesAkinSSE2(const std::uint8_t *genome1, const std::uint8_t *genome2,
+                                     int genomeSize, int maxDifference) noexcept {
+  static constexpr int kStep = 16;
+
+  int diff{};
+  int i{};
+
+  for (; i + kStep <= genomeSize; i += kStep) {
+    // Getting mask of equal genes and counting the others
+    const __m128i      chunk1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(genome1 + i));
+    const __m128i      chunk2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(genome2 + i));
+    const unsigned int equalMask =
+        static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk1, chunk2)));
+    diff += countBits(~equalMask & 0xFFFFu);
+    if (diff > maxDifference) {
+      return false;
+    }
+  }
+
+  // Comparing the rest genes
+  return arePackedGenomesAkinScalar(genome1 + i, genome2 + i, genomeSize - i, maxDifference - diff);
+}
+#endif
+
+#ifdef CELLARIUM_GENOME_COMPARISON_AVX2
+// Compares genomes 32 genes at a time exiting as soon as difference exceeds maxDifference
+__attribute__((target("avx2"))) static bool arePackedGenomesAkinAVX2(
+    const std::uint8_t *genome1, const std::uint8_t *genome2, int genomeSize,
+    int maxDifference) noexcept {
+  static constexpr int kStep = 32;
+
+  int diff{};
+  int i{};
+
+  for (; i + kStep <= genomeSize; i += kStep) {
+    // Getting mask of equal genes and counting the others
+    const __m256i      chunk1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(genome1 + i));
+    const __m256i      chunk2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(genome2 + i));
+    const unsigned int equalMask =
+        static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk1, chunk2)));
+    diff += countBits(~equalMask);
+    if (diff > maxDifference) {
+      return false;
+    }
+  }
+
+  // Comparing the rest genes
+  return arePackedGenomesAkinSSE2(genome1 + i, genome2 + i, genomeSize - i, maxDifference - diff);
+}
+#endif
+
+bool cellarium::isGenomeComparisonKernelSupported(GenomeComparisonKernels kernel) noexcept {
+  switch (kernel) {
+    case GenomeComparisonKernels::Scalar:
+      return true;
+    case GenomeComparisonKernels::SSE2:
+#ifdef CELLARIUM_GENOME_COMPARISON_SSE2
+      return true;
+#else
+      return false;
+#endif
+    case GenomeComparisonKernels::AVX2:
+#ifdef CELLARIUM_GENOME_COMPARISON_AVX2
+      // Initializing CPU feature data as it may be not initialized yet if called before
+      // constructors of runtime library (from static initializer of shared library, for example)
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2");
+#else
+      return false;
+#endif
+  }
+
+  return false;
+}
+
+// Selects the best supported kernel
+static GenomeComparisonKernels selectGenomeComparisonKernel() noexcept {
+  if (isGenomeComparisonKernelSupported(GenomeComparisonKernels::AVX2)) {
+    return GenomeComparisonKernels::AVX2;
+  }
+  if (isGenomeComparisonKernelSupported(GenomeComparisonKernels::SSE2)) {
+    return GenomeComparisonKernels::SSE2;
+  }
+  return GenomeComparisonKernels::Scalar;
+}
+
+bool cellarium::arePackedGenomesAkin(const std::uint8_t *genome1, const std::uint8_t *genome2,
+                                     int genomeSize, int maxDifference) noexcept {
+  return arePackedGenomesAkin(getGenomeComparisonKernel(), genome1, genome2, genomeSize,
+                              maxDifference);
+}
+
+bool cellarium::arePackedGenomesAkin(GenomeComparisonKernels kernel, const std::uint8_t *genome1,
+                                     const std::uint8_t *genome2, int genomeSize,
+                                     int maxDifference) noexcept {
+  switch (kernel) {
+#ifdef CELLARIUM_GENOME_COMPARISON_AVX2
+    case GenomeComparisonKernels::AVX2:
+      return arePackedGenomesAkinAVX2(genome1, genome2, genomeSize, maxDifference);
+#endif
+#ifdef CELLARIUM_GENOME_COMPARISON_SSE2
+    case GenomeComparisonKernels::SSE2:
+      return arePackedGenomesAkinSSE2(genome1, genome2, genomeSize, maxDifference);
+#endif
+    default:
+      return arePackedGenomesAkinScalar(genome1, genome2, genomeSize, maxDifference);
+  }
+}
+
+GenomeComparisonKernels cellarium::getGenomeComparisonKernel() noexcept {
+  // Selecting kernel once on the first use (not in static initializer which may run
+  // before CPU features are known)
+  static const GenomeComparisonKernels kernel = selectGenomeComparisonKernel();
+
+  return kernel;
+}
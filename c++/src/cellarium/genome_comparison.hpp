@@ -0,0 +1,40 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef GENOME_COMPARISON_HPP
+#define GENOME_COMPARISON_HPP
+
+// STD
+#include <cstdint>
+
+namespace cellarium {
+
+// Genome comparison kernels (in order of preference)
+enum class GenomeComparisonKernels {
+  Scalar,
+  SSE2,
+  AVX2,
+};
+
+// Returns whether packed genomes differ in no more than maxDifference genes
+// using the best kernel supported by CPU (selected once at program start)
+bool arePackedGenomesAkin(const std::uint8_t *genome1, const std::uint8_t *genome2, int genomeSize,
+                          int maxDifference) noexcept;
+
+// Returns whether packed genomes differ in no more than maxDifference genes using given kernel
+// (kernel must be supported by CPU)
+bool arePackedGenomesAkin(GenomeComparisonKernels kernel, const std::uint8_t *genome1,
+                          const std::uint8_t *genome2, int genomeSize, int maxDifference) noexcept;
+
+// Returns whether kernel is compiled in and supported by CPU
+bool isGenomeComparisonKernelSupported(GenomeComparisonKernels kernel) noexcept;
+
+// Returns kernel used by arePackedGenomesAkin (the best supported one selected on the first call)
+GenomeComparisonKernels getGenomeComparisonKernel() noexcept;
+
+}
+
+#endif
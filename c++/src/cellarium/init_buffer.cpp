@@ -21,18 +21,23 @@ struct EnvironmentRenderingData {
 };
 
 // Initializes and configures OpenGL Vertex Array and Buffer Objects for cells
-void initCellBuffers(int maxCount, GLuint &vao, GLuint &vbo) {
+void initCellBuffers(int maxCount, int regionCount, GLuint &vao, GLuint &vbo,
+                     cellarium::CellController::CellRenderingData *&mappedData) {
   // Creating and binding VAO
   glGenVertexArrays(1, &vao);
   glBindVertexArray(vao);
 
-  // Creating, binding and configuring VBO
+  // Creating, binding and configuring VBO with immutable storage for all the regions
+  // mapped persistently and coherently (so it is written without map/unmap and flushing)
+  const GLsizeiptr size{static_cast<GLsizeiptr>(
+      static_cast<size_t>(maxCount) * static_cast<size_t>(regionCount) *
+      sizeof(cellarium::CellController::CellRenderingData))};
+  const GLbitfield flags{GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT};
   glGenBuffers(1, &vbo);
   glBindBuffer(GL_ARRAY_BUFFER, vbo);
-  glBufferData(
-      GL_ARRAY_BUFFER,
-      static_cast<GLsizeiptr>(maxCount * sizeof(cellarium::CellController::CellRenderingData)),
-      nullptr, GL_DYNAMIC_DRAW);
+  glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+  mappedData = static_cast<cellarium::CellController::CellRenderingData *>(
+      glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags));
   glVertexAttribIPointer(0, 1, GL_INT, sizeof(cellarium::CellController::CellRenderingData),
                          reinterpret_cast<void *>(0));
   glEnableVertexAttribArray(0);
@@ -46,6 +51,25 @@ void initCellBuffers(int maxCount, GLuint &vao, GLuint &vbo) {
   glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
+// Initializes and configures OpenGL Vertex Array and Texture Objects for cell texture
+void initCellTexture(int columns, int rows, GLuint &vao, GLuint &texture) {
+  // Creating VAO (fullscreen quad vertices are generated in shader)
+  glGenVertexArrays(1, &vao);
+
+  // Creating, binding and configuring texture with texel for each slot
+  // (texel is CellTextureData as two unsigned integers)
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D, texture);
+  glTexStorage2D(GL_TEXTURE_2D, 1, GL_RG32UI, columns, rows);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+  // Unbinding texture
+  glBindTexture(GL_TEXTURE_2D, 0);
+}
+
 // Initializes and configures OpenGL Vertex Array and Buffer Objects for photosynthesis energy
 void initPhotosynthesisEnergyBuffers(float minHeightInClipSpace, GLuint &vao, GLuint &vbo) {
   // Setting vertices and indices
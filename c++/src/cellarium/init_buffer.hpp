@@ -10,8 +10,16 @@
 // OpenGL
 #include <glad/glad.h>
 
+// CellController
+#include "./cell_controller.hpp"
+
 // Initializes and configures OpenGL Vertex Array and Buffer Objects for cells
-void initCellBuffers(int maxCount, GLuint &vao, GLuint &vbo);
+// (buffer is split into regionCount regions of maxCount cells and stays mapped to mappedData)
+void initCellBuffers(int maxCount, int regionCount, GLuint &vao, GLuint &vbo,
+                     cellarium::CellController::CellRenderingData *&mappedData);
+
+// Initializes and configures OpenGL Vertex Array and Texture Objects for cell texture
+void initCellTexture(int columns, int rows, GLuint &vao, GLuint &texture);
 
 // Initializes and configures OpenGL Vertex Array and Buffer Objects for photosynthesis energy
 void initPhotosynthesisEnergyBuffers(float minHeightInClipSpace, GLuint &vao, GLuint &vbo);
@@ -10,6 +10,18 @@
 // "extra" internal library
 #include "./extra/extra.hpp"
 
+// CellController
+#include "./cell_controller.hpp"
+
+// Cell texture shader program relies on values of slot states and cell rendering modes
+static_assert(static_cast<int>(cellarium::CellTextureStates::Empty) == 0 &&
+              static_cast<int>(cellarium::CellTextureStates::Dead) == 1 &&
+              static_cast<int>(cellarium::CellTextureStates::Selected) == 3);
+static_assert(static_cast<int>(cellarium::CellRenderingModes::Diet) == 0 &&
+              static_cast<int>(cellarium::CellRenderingModes::EnergyLevel) == 1 &&
+              static_cast<int>(cellarium::CellRenderingModes::EnergySharingBalance) == 2 &&
+              static_cast<int>(cellarium::CellRenderingModes::LastEnergyShare) == 3);
+
 // Creates, compiles and links cell shader program
 GLuint initCellShaderProgram() {
   // Initializing vector of shader types
@@ -86,6 +98,83 @@ GLuint initCellShaderProgram() {
   return extra::createShaderProgram(shaderTypes, shaderSources);
 }
 
+// Creates, compiles and links cell texture shader program
+GLuint initCellTextureShaderProgram() {
+  // Initializing vector of shader types
+  const std::vector<GLenum> shaderTypes{
+      GL_VERTEX_SHADER,
+      GL_FRAGMENT_SHADER,
+  };
+
+  // Initializing vector of shader sources
+  const std::vector<std::string> shaderSources{
+      std::string{"#version 460 core\n"
+                  "\n"
+                  "out vec2 fTexCoords;\n"
+                  "\n"
+                  "vec2 kPosXY[4] = {\n"
+                  "  vec2(-1.0f,  1.0f),\n"
+                  "  vec2( 1.0f,  1.0f),\n"
+                  "  vec2(-1.0f, -1.0f),\n"
+                  "  vec2( 1.0f, -1.0f)\n"
+                  "};\n"
+                  "\n"
+                  "void main() {\n"
+                  "  vec2 posXY  = kPosXY[gl_VertexID];\n"
+                  "  gl_Position = vec4(posXY, 0.0f, 1.0f);\n"
+                  "  fTexCoords  = vec2(posXY.x + 1.0f, 1.0f - posXY.y) * 0.5f;\n"
+                  "}\n"},
+      std::string{"#version 460 core\n"
+                  "\n"
+                  "uniform usampler2D kCells;\n"
+                  "uniform int        kCellRenderingMode;\n"
+                  "\n"
+                  "const uint kEmptyState    = 0u;\n"
+                  "const uint kDeadState     = 1u;\n"
+                  "const uint kSelectedState = 3u;\n"
+                  "\n"
+                  "const int kDietMode                 = 0;\n"
+                  "const int kEnergyLevelMode          = 1;\n"
+                  "const int kEnergySharingBalanceMode = 2;\n"
+                  "const int kLastEnergyShareMode      = 3;\n"
+                  "\n"
+                  "in vec2 fTexCoords;\n"
+                  "\n"
+                  "out vec4 FragColor;\n"
+                  "\n"
+                  "void main() {\n"
+                  "  uvec2 texel      = texture(kCells, fTexCoords).rg;\n"
+                  "  vec3  dietColor  = unpackUnorm4x8(texel.r).rgb;\n"
+                  "  uint  state      = texel.r >> 24u;\n"
+                  "  vec4  attributes = unpackUnorm4x8(texel.g);\n"
+                  "\n"
+                  "  if (state == kEmptyState) {\n"
+                  "    FragColor = vec4(0.0f);\n"
+                  "  } else if (state == kDeadState) {\n"
+                  "    FragColor = vec4(0.75f, 0.75f, 0.75f, 1.0f);\n"
+                  "  } else if (state == kSelectedState) {\n"
+                  "    FragColor = vec4(0.0f, 0.0f, 0.0f, 1.0f);\n"
+                  "  } else if (kCellRenderingMode == kDietMode) {\n"
+                  "    FragColor = vec4(dietColor / max(length(dietColor), 0.001f), 1.0f);\n"
+                  "  } else if (kCellRenderingMode == kEnergyLevelMode) {\n"
+                  "    FragColor = vec4(1.0f, 1.0f - attributes.x, 0.0f, 1.0f);\n"
+                  "  } else if (kCellRenderingMode == kEnergySharingBalanceMode) {\n"
+                  "    float t   = attributes.y;\n"
+                  "    FragColor = vec4(1.0f - t, 0.5f + 0.5f * t, t, 1.0f);\n"
+                  "  } else if (kCellRenderingMode == kLastEnergyShareMode) {\n"
+                  "    float t   = attributes.z;\n"
+                  "    FragColor = vec4(1.0f - t, 0.5f + 0.5f * t, t, 1.0f);\n"
+                  "  } else {\n"
+                  "    float t   = attributes.w;\n"
+                  "    FragColor = vec4(t, 1.0f - t, 1.0f - t, 1.0f);\n"
+                  "  }\n"
+                  "}\n"},
+  };
+
+  // Creating shader program and returning it
+  return extra::createShaderProgram(shaderTypes, shaderSources);
+}
+
 // Creates, compiles and links photosynthesis energy shader program
 GLuint initPhotosynthesisEnergyShaderProgram() {
   // Initializing vector of shader types
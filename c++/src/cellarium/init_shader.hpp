@@ -13,6 +13,9 @@
 // Creates, compiles and links cell shader program
 GLuint initCellShaderProgram();
 
+// Creates, compiles and links cell texture shader program
+GLuint initCellTextureShaderProgram();
+
 // Creates, compiles and links photosynthesis energy shader program
 GLuint initPhotosynthesisEnergyShaderProgram();
 
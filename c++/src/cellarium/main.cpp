@@ -5,6 +5,7 @@
 // https://opensource.org/licenses/MIT.
 
 // STD
+#include <array>
 #include <string_view>
 
 // Qt
@@ -27,10 +28,29 @@
 // CellController
 #include "./cell_controller.hpp"
 
+// ReplayRecorder
+#include "./replay_log.hpp"
+
+// SimulationThread
+#include "./simulation_thread.hpp"
+
 // Global constants
-static constexpr std::string_view kWindowTitle        = "cellarium";
-static constexpr int              kOpenGLVersionMajor = 4;
-static constexpr int              kOpenGLVersionMinor = 6;
+static constexpr std::string_view kWindowTitle                = "cellarium";
+static constexpr int              kOpenGLVersionMajor         = 4;
+static constexpr int              kOpenGLVersionMinor         = 6;
+static constexpr double           kIdleEventsTimeoutInSeconds = 0.1;
+
+// Returns settings of simulation thread from controls
+static SimulationSettings getSimulationSettings(const Controls &controls) {
+  SimulationSettings settings{};
+  settings.cellRenderingMode = controls.cellRenderingMode;
+  settings.ticksPerRender    = controls.ticksPerRender;
+  settings.enableRendering        = controls.enableRendering;
+  settings.enableTextureRendering = controls.enableTextureRendering;
+  settings.enablePause            = controls.enablePause;
+
+  return settings;
+}
 
 // Main function
 int main(int argc, char *argv[]) {
@@ -43,6 +63,7 @@ int main(int argc, char *argv[]) {
   controls.ticksPerRender             = 1;
   controls.enableRendering            = true;
   controls.enableRenderingEnvironment = true;
+  controls.enableTextureRendering     = true;
   controls.enablePause                = false;
   controls.enableFullscreenMode       = false;
   controls.enableVSync                = true;
@@ -60,7 +81,18 @@ int main(int argc, char *argv[]) {
   cellarium::CellController cellController{cellControllerParams};
 
   // Configuring Controls struct
-  controls.cellControllerPtr = &cellController;
+  controls.columns    = cellController.getColumns();
+  controls.rows       = cellController.getRows();
+  controls.genomeSize = cellController.getGenomeSize();
+  controls.parameters = cellController.getParameters();
+
+  // Starting recording of replay log if specified
+  cellarium::ReplayRecorder replayRecorder{};
+  if (!controls.replayLogFilename.empty() &&
+      replayRecorder.open(controls.replayLogFilename, cellController,
+                          cellarium::kInitReplayHashPeriodInTicks) != 0) {
+    return 1;
+  }
 
   // Initializing GLFW and getting configured window with OpenGL context
   extra::initGLFW();
@@ -94,6 +126,7 @@ int main(int argc, char *argv[]) {
 
   // Creating, compiling and linking cell and environment shader programs
   const GLuint cellShaderProgram                 = initCellShaderProgram();
+  const GLuint cellTextureShaderProgram          = initCellTextureShaderProgram();
   const GLuint photosynthesisEnergyShaderProgram = initPhotosynthesisEnergyShaderProgram();
   const GLuint mineralEnergyShaderProgram        = initMineralEnergyShaderProgram();
 
@@ -104,8 +137,17 @@ int main(int argc, char *argv[]) {
   glUseProgram(0);
 
   // Initializing and configuring OpenGL Vertex Array and Buffer Objects for cells and environment
-  GLuint cellVAO{}, cellVBO{};
-  initCellBuffers(cellController.getColumns() * cellController.getRows(), cellVAO, cellVBO);
+  // (cell buffer has region for each simulation frame so simulation renders straight into it)
+  const int      maxCellCount{cellController.getColumns() * cellController.getRows()};
+  const GLintptr cellBufferRegionSize{static_cast<GLintptr>(
+      sizeof(cellarium::CellController::CellRenderingData) * static_cast<size_t>(maxCellCount))};
+
+  GLuint                                        cellVAO{}, cellVBO{};
+  cellarium::CellController::CellRenderingData *cellRenderingData{};
+  initCellBuffers(maxCellCount, SimulationThread::kFrameCount, cellVAO, cellVBO, cellRenderingData);
+  GLuint cellTextureVAO{}, cellTexture{};
+  initCellTexture(cellController.getColumns(), cellController.getRows(), cellTextureVAO,
+                  cellTexture);
   GLuint photosynthesisEnergyVAO{}, photosynthesisEnergyVBO{};
   initPhotosynthesisEnergyBuffers(
       static_cast<float>(1 -
@@ -116,8 +158,19 @@ int main(int argc, char *argv[]) {
       static_cast<float>(-1 + 2 * cellController.getMaxMineralHeight() / cellController.getRows()),
       mineralEnergyVAO, mineralEnergyVBO);
 
-  // Initializing ticks passed value
-  int ticksPassed{};
+  // Fences of cell buffer regions signaled when rendering from them is complete
+  // and number of frame cell texture has been updated to
+  std::array<GLsync, SimulationThread::kFrameCount> cellBufferFences{};
+  int                                               cellTextureFrameNumber{};
+
+  // Starting simulation thread (it is not accessed from this thread anymore
+  // and the thread is stopped before simulation is destroyed)
+  // (region of frame is given back to simulation only after it is not rendered from anymore)
+  SimulationThread simulationThread{
+      cellController, replayRecorder.isOpen() ? &replayRecorder : nullptr,
+      getSimulationSettings(controls), cellRenderingData,
+      [&cellBufferFences](int frameIndex) { waitCellBuffer(cellBufferFences[frameIndex]); }};
+  controls.simulationThreadPtr = &simulationThread;
 
   // Render cycle
   while (!glfwWindowShouldClose(window)) {
@@ -127,49 +180,59 @@ int main(int argc, char *argv[]) {
     // Processing user input
     processUserInput(window, controls);
 
-    // Checking if current tick should be rendered
-    bool renderCurrTick = controls.enableRendering && (ticksPassed % controls.ticksPerRender == 0);
+    // Passing controls and tick request to simulation thread
+    simulationThread.setSettings(getSimulationSettings(controls));
+    if (controls.tickRequest) {
+      simulationThread.requestTick();
 
-    // If simulation is not paused or a tick is requested
-    if (!controls.enablePause || controls.tickRequest) {
-      // Computing next simulation tick
-      cellController.act();
-
-      // Tick request is satisfied
+      // Tick request is passed
       controls.tickRequest = false;
     }
 
-    // If current tick should be rendered
-    if (renderCurrTick) {
-      // Zeroing ticks passed value
-      ticksPassed = 0;
-
-      // Clearing color buffer
-      glClear(GL_COLOR_BUFFER_BIT);
+    // Waiting for events if rendering is disabled (so this thread does not spin)
+    if (!controls.enableRendering) {
+      glfwWaitEventsTimeout(kIdleEventsTimeoutInSeconds);
+      continue;
+    }
 
-      // Rendering environment if needed
-      if (controls.enableRenderingEnvironment) {
-        renderMineralEnergyBuffer(mineralEnergyShaderProgram, mineralEnergyVAO);
-        renderPhotosynthesisEnergyBuffer(photosynthesisEnergyShaderProgram, photosynthesisEnergyVAO,
-                                         cellController.getSunPosition(),
-                                         cellController.getDaytimeWidth());
-      }
+    // Getting the latest frame published by simulation thread
+    const SimulationFrame &frame = simulationThread.getFrame();
 
-      // Rendering cells
-      renderCellBuffer(cellShaderProgram, cellVAO, cellVBO, cellController,
-                       controls.cellRenderingMode);
+    // Clearing color buffer
+    glClear(GL_COLOR_BUFFER_BIT);
 
-      // Processing Dear ImGui windows
-      processDearImGui(window, controls);
+    // Rendering environment if needed
+    if (controls.enableRenderingEnvironment) {
+      renderMineralEnergyBuffer(mineralEnergyShaderProgram, mineralEnergyVAO);
+      renderPhotosynthesisEnergyBuffer(photosynthesisEnergyShaderProgram, photosynthesisEnergyVAO,
+                                       frame.sunPosition, frame.daytimeWidth);
+    }
 
-      // Swapping front and back buffers
-      glfwSwapBuffers(window);
+    // Rendering cells from texture or as points expanded to quads
+    // (only rows changed since the last uploaded frame are uploaded once for each frame)
+    if (frame.isRenderedToTexture) {
+      if (frame.number != cellTextureFrameNumber) {
+        updateCellTexture(cellTexture, cellVBO, cellBufferRegionSize * frame.index,
+                          controls.columns, controls.rows, frame.changedRows.data());
+        cellTextureFrameNumber = frame.number;
+      }
+      renderCellTexture(cellTextureShaderProgram, cellTextureVAO, cellTexture,
+                        controls.cellRenderingMode, cellBufferFences[frame.index]);
+    } else {
+      renderCellBuffer(cellShaderProgram, cellVAO, frame.index * maxCellCount, frame.cellCount,
+                       cellBufferFences[frame.index]);
     }
 
-    // Updating ticks passed value
-    ++ticksPassed;
+    // Processing Dear ImGui windows
+    processDearImGui(window, controls, frame);
+
+    // Swapping front and back buffers
+    glfwSwapBuffers(window);
   }
 
+  // Stopping simulation thread before cell buffer is unmapped
+  simulationThread.stop();
+
   // Terminating Dear ImGui context
   terminateDearImGui();
 
@@ -178,10 +241,21 @@ int main(int argc, char *argv[]) {
   glDeleteVertexArrays(1, &mineralEnergyVAO);
   glDeleteBuffers(1, &photosynthesisEnergyVBO);
   glDeleteVertexArrays(1, &photosynthesisEnergyVAO);
+  for (GLsync &fence : cellBufferFences) {
+    if (fence != nullptr) {
+      glDeleteSync(fence);
+    }
+  }
+  glBindBuffer(GL_ARRAY_BUFFER, cellVBO);
+  glUnmapBuffer(GL_ARRAY_BUFFER);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
   glDeleteBuffers(1, &cellVBO);
   glDeleteVertexArrays(1, &cellVAO);
+  glDeleteTextures(1, &cellTexture);
+  glDeleteVertexArrays(1, &cellTextureVAO);
   glDeleteProgram(mineralEnergyShaderProgram);
   glDeleteProgram(photosynthesisEnergyShaderProgram);
+  glDeleteProgram(cellTextureShaderProgram);
   glDeleteProgram(cellShaderProgram);
 
   // Terminating window with OpenGL context and GLFW
@@ -0,0 +1,140 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Header file
+#include "./random_stream.hpp"
+
+// STD
+#include <algorithm>
+#include <utility>
+
+// Using header file namespace
+using namespace cellarium;
+
+// Philox4x32 round multipliers and key increments (Weyl sequence)
+static constexpr std::uint32_t kPhiloxMultiplier0 = 0xD2511F53u;
+static constexpr std::uint32_t kPhiloxMultiplier1 = 0xCD9E8D57u;
+static constexpr std::uint32_t kPhiloxWeyl0       = 0x9E3779B9u;
+static constexpr std::uint32_t kPhiloxWeyl1       = 0xBB67AE85u;
+// Count of Philox4x32 rounds
+static constexpr int kPhiloxRoundCount = 10;
+
+std::array<std::uint32_t, kPhiloxBlockSize> cellarium::generatePhiloxBlock(
+    const std::array<std::uint32_t, kPhiloxBlockSize> &counter,
+    const std::array<std::uint32_t, 2>                &key) noexcept {
+  std::array<std::uint32_t, kPhiloxBlockSize> block{counter};
+  std::array<std::uint32_t, 2>                roundKey{key};
+
+  for (int round = 0; round < kPhiloxRoundCount; ++round) {
+    // Multiplying counter words getting high and low halves of products
+    const std::uint64_t product0 = static_cast<std::uint64_t>(kPhiloxMultiplier0) * block[0];
+    const std::uint64_t product1 = static_cast<std::uint64_t>(kPhiloxMultiplier1) * block[2];
+
+    // Mixing halves of products with the rest counter words and round key
+    block = {
+        static_cast<std::uint32_t>(product1 >> 32) ^ block[1] ^ roundKey[0],
+        static_cast<std::uint32_t>(product1),
+        static_cast<std::uint32_t>(product0 >> 32) ^ block[3] ^ roundKey[1],
+        static_cast<std::uint32_t>(product0),
+    };
+
+    // Bumping round key
+    roundKey[0] += kPhiloxWeyl0;
+    roundKey[1] += kPhiloxWeyl1;
+  }
+
+  return block;
+}
+
+RandomStream::RandomStream() noexcept {}
+
+RandomStream::RandomStream(std::mt19937 *mersenneTwisterEngine) noexcept
+    : _mersenneTwisterEngine{mersenneTwisterEngine} {}
+
+RandomStream::RandomStream(unsigned int seed, RandomStreamDomains domain, int year, int tick,
+                           int index) noexcept
+    : _counter{0u, static_cast<std::uint32_t>(index), static_cast<std::uint32_t>(tick),
+               static_cast<std::uint32_t>(year)},
+      _key{seed, static_cast<std::uint32_t>(domain)} {}
+
+RandomStream::RandomStream(const RandomStream &randomStream) noexcept
+    : _mersenneTwisterEngine{randomStream._mersenneTwisterEngine},
+      _counter{randomStream._counter},
+      _key{randomStream._key},
+      _block{randomStream._block},
+      _blockPosition{randomStream._blockPosition} {}
+
+RandomStream &RandomStream::operator=(const RandomStream &randomStream) noexcept {
+  _mersenneTwisterEngine = randomStream._mersenneTwisterEngine;
+  _counter               = randomStream._counter;
+  _key                   = randomStream._key;
+  _block                 = randomStream._block;
+  _blockPosition         = randomStream._blockPosition;
+
+  return *this;
+}
+
+RandomStream::RandomStream(RandomStream &&randomStream) noexcept
+    : _mersenneTwisterEngine{std::exchange(randomStream._mersenneTwisterEngine, nullptr)},
+      _counter{std::exchange(randomStream._counter, {})},
+      _key{std::exchange(randomStream._key, {})},
+      _block{std::exchange(randomStream._block, {})},
+      _blockPosition{std::exchange(randomStream._blockPosition, kPhiloxBlockSize)} {}
+
+RandomStream &RandomStream::operator=(RandomStream &&randomStream) noexcept {
+  std::swap(_mersenneTwisterEngine, randomStream._mersenneTwisterEngine);
+  std::swap(_counter, randomStream._counter);
+  std::swap(_key, randomStream._key);
+  std::swap(_block, randomStream._block);
+  std::swap(_blockPosition, randomStream._blockPosition);
+
+  return *this;
+}
+
+RandomStream::~RandomStream() noexcept {}
+
+RandomStream::result_type RandomStream::operator()() noexcept {
+  // Drawing from shared sequential generator if there is one
+  if (_mersenneTwisterEngine != nullptr) {
+    return (*_mersenneTwisterEngine)();
+  }
+
+  // Generating the next block if the current one is drawn
+  if (_blockPosition == kPhiloxBlockSize) {
+    _block = generatePhiloxBlock(_counter, _key);
+    ++_counter[0];
+    _blockPosition = 0;
+  }
+
+  return _block[_blockPosition++];
+}
+
+int RandomStream::drawInRange(int bound) noexcept {
+  // Taking high half of number multiplied by bound (Lemire's method)
+  const std::uint32_t range   = static_cast<std::uint32_t>(bound);
+  std::uint64_t       product = static_cast<std::uint64_t>(operator()()) * range;
+
+  // Redrawing while number falls into the biased remainder (2^32 mod bound low halves)
+  if (static_cast<std::uint32_t>(product) < range) {
+    const std::uint32_t threshold = (0u - range) % range;
+    while (static_cast<std::uint32_t>(product) < threshold) {
+      product = static_cast<std::uint64_t>(operator()()) * range;
+    }
+  }
+
+  return static_cast<int>(product >> 32);
+}
+
+bool RandomStream::drawWithProbability(float probability) noexcept {
+  // Local constant
+  static constexpr double kNumberCount{4294967296.0};
+
+  // Calculating threshold number in range [0, 2^32) is less than with given probability
+  const std::uint64_t threshold = static_cast<std::uint64_t>(
+      std::clamp(static_cast<double>(probability), 0.0, 1.0) * kNumberCount);
+
+  return static_cast<std::uint64_t>(operator()()) < threshold;
+}
@@ -0,0 +1,81 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef RANDOM_STREAM_HPP
+#define RANDOM_STREAM_HPP
+
+// STD
+#include <array>
+#include <cstdint>
+#include <random>
+
+namespace cellarium {
+
+// Count of numbers in one Philox block
+static constexpr int kPhiloxBlockSize = 4;
+
+// Returns Philox4x32-10 block of pseudo-random numbers (pure function of counter and key)
+std::array<std::uint32_t, kPhiloxBlockSize> generatePhiloxBlock(
+    const std::array<std::uint32_t, kPhiloxBlockSize> &counter,
+    const std::array<std::uint32_t, 2>                &key) noexcept;
+
+// Purposes pseudo-random numbers are drawn for (counter-based streams of different purposes
+// of the same cell at the same tick do not overlap)
+enum class RandomStreamDomains {
+  Act,
+  GammaFlash,
+};
+
+// Class for drawing pseudo-random numbers either from shared sequential generator
+// or from counter-based generator where each number is a function of
+// (seed, domain, year, tick, cell index, draw index) so it does not depend on drawing order
+// (numbers are not drawn ahead in blocks from shared generator: a tick draws 1-2 numbers
+// per live cell, so they cost a few percent of it, and generator state saved in snapshots
+// must be the state after the last drawn number)
+class RandomStream {
+ public:
+  using result_type = std::uint32_t;
+
+ private:
+  // Shared sequential generator (counter-based generator is used if there is none)
+  std::mt19937 *_mersenneTwisterEngine{};
+
+  // Counter-based generator counter (block index, cell index, tick, year) and key (seed, domain)
+  std::array<std::uint32_t, kPhiloxBlockSize> _counter{};
+  std::array<std::uint32_t, 2>                _key{};
+
+  // Current block of numbers and position of the next number to draw in it
+  std::array<std::uint32_t, kPhiloxBlockSize> _block{};
+  int                                         _blockPosition{kPhiloxBlockSize};
+
+ public:
+  RandomStream() noexcept;
+  explicit RandomStream(std::mt19937 *mersenneTwisterEngine) noexcept;
+  RandomStream(unsigned int seed, RandomStreamDomains domain, int year, int tick,
+               int index) noexcept;
+  RandomStream(const RandomStream &randomStream) noexcept;
+  RandomStream &operator=(const RandomStream &randomStream) noexcept;
+  RandomStream(RandomStream &&randomStream) noexcept;
+  RandomStream &operator=(RandomStream &&randomStream) noexcept;
+  ~RandomStream() noexcept;
+
+  // Draws the next number
+  result_type operator()() noexcept;
+
+  // Draws uniformly distributed integer in range from 0 to positive bound (exclusive)
+  // without bias of scaling number to bound
+  int drawInRange(int bound) noexcept;
+  // Draws true with given probability (comparing number with threshold instead of dividing it)
+  bool drawWithProbability(float probability) noexcept;
+
+  // Range of numbers (the same as std::mt19937 has)
+  static constexpr result_type min() noexcept { return 0u; }
+  static constexpr result_type max() noexcept { return 0xFFFFFFFFu; }
+};
+
+}
+
+#endif
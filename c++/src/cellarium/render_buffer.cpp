@@ -7,38 +7,122 @@
 // Header file
 #include "./render_buffer.hpp"
 
-// Renders cells from buffer
-void renderCellBuffer(GLuint shaderProgram, GLuint vao, GLuint vbo,
-                      cellarium::CellController &cellController, int cellRenderingMode) {
-  // Binding VBO
-  glBindBuffer(GL_ARRAY_BUFFER, vbo);
-  // Getting current count of cells in simulation
-  int renderingDataSize = static_cast<int>(cellController.getCellCount());
-  // Mapping VBO buffer partly
-  cellarium::CellController::CellRenderingData *cellRenderingData =
-      static_cast<cellarium::CellController::CellRenderingData *>(
-          glMapBufferRange(GL_ARRAY_BUFFER, 0, renderingDataSize, GL_MAP_WRITE_BIT));
-
-  // Passing VBO buffer to CellController that fills it with rendering data
-  cellController.render(cellRenderingData, cellRenderingMode);
-
-  // Unmapping VBO buffer
-  glUnmapBuffer(GL_ARRAY_BUFFER);
-  // Unbinding VBO
-  glBindBuffer(GL_ARRAY_BUFFER, 0);
+// CellController
+#include "./cell_controller.hpp"
 
+// Replaces fence of region of cell buffer (the new one is signaled after all the previous commands)
+static void fenceCellBuffer(GLsync &fence) {
+  if (fence != nullptr) {
+    glDeleteSync(fence);
+  }
+  fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+// Renders cells from region of buffer and fences the region
+void renderCellBuffer(GLuint shaderProgram, GLuint vao, int firstCell, int cellCount,
+                      GLsync &fence) {
   // Using shader program
   glUseProgram(shaderProgram);
   // Binding VAO
   glBindVertexArray(vao);
 
   // Rendering elements
-  glDrawArrays(GL_POINTS, 0, renderingDataSize);
+  glDrawArrays(GL_POINTS, firstCell, cellCount);
 
   // Unbinding VAO
   glBindVertexArray(0);
   // Using shader program
   glUseProgram(0);
+
+  // Fencing region
+  fenceCellBuffer(fence);
+}
+
+// Updates rows of cell texture flagged as changed from region of buffer
+void updateCellTexture(GLuint texture, GLuint vbo, GLintptr offset, int columns, int rows,
+                       const std::uint8_t *changedRows) {
+  // Local constant
+  static constexpr GLintptr kTexelSize = sizeof(cellarium::CellController::CellTextureData);
+
+  // Binding buffer as pixel source and texture
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, vbo);
+  glBindTexture(GL_TEXTURE_2D, texture);
+
+  // Updating each run of consecutive changed rows from region of buffer
+  // without copying it on CPU
+  int row = 0;
+  while (row < rows) {
+    // Skipping unchanged rows
+    if (changedRows[row] == 0) {
+      ++row;
+      continue;
+    }
+
+    // Finding end of run of changed rows and updating them
+    const int firstRow = row;
+    while (row < rows && changedRows[row] != 0) {
+      ++row;
+    }
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, firstRow, columns, row - firstRow, GL_RG_INTEGER,
+                    GL_UNSIGNED_INT,
+                    reinterpret_cast<void *>(offset + kTexelSize * columns * firstRow));
+  }
+
+  // Unbinding buffer and texture
+  glBindTexture(GL_TEXTURE_2D, 0);
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+// Renders cells from texture in given rendering mode and fences region of buffer
+// texture has been updated from
+void renderCellTexture(GLuint shaderProgram, GLuint vao, GLuint texture, int cellRenderingMode,
+                       GLsync &fence) {
+  // Using shader program
+  glUseProgram(shaderProgram);
+  // Updating shader program uniform variable
+  glUniform1i(glGetUniformLocation(shaderProgram, "kCellRenderingMode"), cellRenderingMode);
+  // Binding VAO and texture
+  glBindVertexArray(vao);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, texture);
+
+  // Rendering fullscreen quad
+  glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+  // Unbinding VAO and texture
+  glBindVertexArray(0);
+  glBindTexture(GL_TEXTURE_2D, 0);
+  // Using shader program
+  glUseProgram(0);
+
+  // Fencing region
+  fenceCellBuffer(fence);
+}
+
+// Waits until rendering from region of cell buffer is complete so it can be written again
+void waitCellBuffer(GLsync &fence) {
+  // Local constant
+  static constexpr GLuint64 kTimeoutInNanoseconds = 1'000'000;
+
+  // Skipping if region has not been rendered from yet
+  if (fence == nullptr) {
+    return;
+  }
+
+  // Waiting for fence flushing commands before the first waiting
+  GLbitfield flags{GL_SYNC_FLUSH_COMMANDS_BIT};
+  while (true) {
+    const GLenum result = glClientWaitSync(fence, flags, kTimeoutInNanoseconds);
+    if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED ||
+        result == GL_WAIT_FAILED) {
+      break;
+    }
+    flags = 0;
+  }
+
+  // Deleting fence
+  glDeleteSync(fence);
+  fence = nullptr;
 }
 
 // Renders photosynthesis energy from buffer
@@ -7,14 +7,23 @@
 #ifndef RENDER_BUFFER_HPP
 #define RENDER_BUFFER_HPP
 
+// STD
+#include <cstdint>
+
 // OpenGL
 #include <glad/glad.h>
 
-// CellController
-#include "./cell_controller.hpp"
+// Renders cells from region of buffer and fences the region
+void renderCellBuffer(GLuint shaderProgram, GLuint vao, int firstCell, int cellCount, GLsync &fence);
+
+// Updates rows of cell texture flagged as changed from region of buffer
+void updateCellTexture(GLuint texture, GLuint vbo, GLintptr offset, int columns, int rows, const std::uint8_t *changedRows);
+
+// Renders cells from texture in given rendering mode and fences region of buffer texture has been updated from
+void renderCellTexture(GLuint shaderProgram, GLuint vao, GLuint texture, int cellRenderingMode, GLsync &fence);
 
-// Renders cells from buffer
-void renderCellBuffer(GLuint shaderProgram, GLuint vao, GLuint vbo, cellarium::CellController &cellController, int cellRenderingMode);
+// Waits until rendering from region of cell buffer is complete so it can be written again
+void waitCellBuffer(GLsync &fence);
 
 // Renders photosynthesis energy from buffer
 void renderPhotosynthesisEnergyBuffer(GLuint shaderProgram, GLuint vao, float offsetX, float widthScale);
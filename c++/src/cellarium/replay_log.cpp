@@ -0,0 +1,171 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Header file
+#include "./replay_log.hpp"
+
+// STD
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// Using header file namespace
+using namespace cellarium;
+
+ReplayRecorder::ReplayRecorder() noexcept {}
+
+int ReplayRecorder::open(const std::string &filename, const CellController &cellController,
+                         int hashPeriodInTicks) {
+  // Opening replay log file
+  _file.open(filename, std::ios::binary | std::ios::trunc);
+  if (!_file.is_open()) {
+    std::cout << "error: cannot create " << filename << std::endl;
+    return -1;
+  }
+
+  // Writing header and snapshot of current state
+  const std::vector<std::uint8_t> snapshot{cellController.saveSnapshot()};
+  ReplayLogHeader                 header{};
+  header.magic             = kReplayLogMagic;
+  header.version           = kReplayLogVersion;
+  header.byteOrderMark     = kSnapshotByteOrderMark;
+  header.hashPeriodInTicks = std::max(hashPeriodInTicks, 1);
+  header.snapshotSize      = snapshot.size();
+  _file.write(reinterpret_cast<const char *>(&header), sizeof(ReplayLogHeader));
+  _file.write(reinterpret_cast<const char *>(snapshot.data()),
+              static_cast<std::streamsize>(snapshot.size()));
+  if (!_file) {
+    std::cout << "error: cannot write " << filename << std::endl;
+    _file.close();
+    return -1;
+  }
+
+  _hashPeriodInTicks = header.hashPeriodInTicks;
+  _tick              = 0;
+  _parameters        = cellController.getParameters();
+
+  return 0;
+}
+
+bool ReplayRecorder::isOpen() const noexcept { return _file.is_open(); }
+
+int ReplayRecorder::recordParameters(const CellController &cellController) {
+  // Ignoring if parameters have not been changed
+  const SnapshotParameters parameters{cellController.getParameters()};
+  if (std::memcmp(&parameters, &_parameters, sizeof(SnapshotParameters)) == 0) {
+    return 0;
+  }
+  _parameters = parameters;
+
+  // Writing parameters record
+  ReplayRecord record{};
+  record.tick       = _tick;
+  record.type       = static_cast<std::int32_t>(ReplayRecordTypes::Parameters);
+  record.parameters = parameters;
+  _file.write(reinterpret_cast<const char *>(&record), sizeof(ReplayRecord));
+  if (!_file) {
+    std::cout << "error: cannot write replay log" << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+int ReplayRecorder::recordTick(const CellController &cellController) {
+  // Ignoring if hash period has not ended yet
+  ++_tick;
+  if (_tick % _hashPeriodInTicks != 0) {
+    return 0;
+  }
+
+  // Writing state hash record
+  ReplayRecord record{};
+  record.tick      = _tick;
+  record.type      = static_cast<std::int32_t>(ReplayRecordTypes::StateHash);
+  record.stateHash = cellController.calculateStateHash();
+  _file.write(reinterpret_cast<const char *>(&record), sizeof(ReplayRecord));
+  if (!_file) {
+    std::cout << "error: cannot write replay log" << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+int cellarium::replayLog(const std::string &filename, CellController &cellController,
+                         long &divergedTick, long &hashCount) {
+  // Opening replay log file and getting its size
+  std::ifstream file{filename, std::ios::binary | std::ios::ate};
+  if (!file.is_open()) {
+    std::cout << "error: cannot open " << filename << std::endl;
+    return -1;
+  }
+  const std::uint64_t fileSize = static_cast<std::uint64_t>(file.tellg());
+  file.seekg(0);
+
+  // Reading and checking header
+  ReplayLogHeader header{};
+  file.read(reinterpret_cast<char *>(&header), sizeof(ReplayLogHeader));
+  if (!file || header.magic != kReplayLogMagic) {
+    std::cout << "error: " << filename << " is not a cellarium replay log" << std::endl;
+    return -1;
+  }
+  if (header.byteOrderMark != kSnapshotByteOrderMark || header.version != kReplayLogVersion) {
+    std::cout << "error: replay log version " << header.version
+              << " or byte order is not supported (expected version " << kReplayLogVersion << ")"
+              << std::endl;
+    return -1;
+  }
+  if (header.hashPeriodInTicks < 1 || header.snapshotSize > fileSize - sizeof(ReplayLogHeader)) {
+    std::cout << "error: " << filename << " is corrupted" << std::endl;
+    return -1;
+  }
+
+  // Restoring simulation state at the beginning of recording
+  std::vector<std::uint8_t> snapshot(header.snapshotSize);
+  file.read(reinterpret_cast<char *>(snapshot.data()),
+            static_cast<std::streamsize>(snapshot.size()));
+  if (!file || cellController.loadSnapshot(snapshot.data(), snapshot.size()) != 0) {
+    return -1;
+  }
+
+  // Replaying records (interrupted recording may leave incomplete record at the end)
+  long         tick{};
+  ReplayRecord record{};
+  divergedTick = -1;
+  hashCount    = 0;
+  while (file.read(reinterpret_cast<char *>(&record), sizeof(ReplayRecord))) {
+    if (record.tick < tick || record.type < 0 ||
+        record.type >= static_cast<int>(ReplayRecordTypes::Size)) {
+      std::cout << "error: replay log record at tick " << record.tick << " is corrupted"
+                << std::endl;
+      return -1;
+    }
+
+    // Computing ticks until the record one
+    for (; tick < record.tick; ++tick) {
+      cellController.act();
+    }
+
+    // Applying parameters changed before the tick
+    if (record.type == static_cast<int>(ReplayRecordTypes::Parameters)) {
+      if (cellController.setParameters(record.parameters) != 0) {
+        return -1;
+      }
+      continue;
+    }
+
+    // Comparing state hash stopping on the first one which differs
+    ++hashCount;
+    if (cellController.calculateStateHash() != record.stateHash) {
+      divergedTick = tick;
+      break;
+    }
+  }
+
+  return 0;
+}
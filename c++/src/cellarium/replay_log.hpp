@@ -0,0 +1,100 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Replay log of simulation (see ReplayRecorder and replayLog())
+//
+// Replay log is a header followed by snapshot of simulation at the beginning of recording and
+// fixed-size records of parameter changes and state hashes in tick order (in native byte order
+// as snapshot itself). Replaying it with other build of simulation restores snapshot, applies
+// parameter changes at the same ticks and compares state hashes, so the first hash period where
+// simulation goes other way is found without storing anything but hashes.
+
+#ifndef REPLAY_LOG_HPP
+#define REPLAY_LOG_HPP
+
+// STD
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <type_traits>
+
+// "cell_controller" internal header
+#include "./cell_controller.hpp"
+
+namespace cellarium {
+
+// Replay log signature and format version
+static constexpr std::array<char, 8> kReplayLogMagic{'C', 'E', 'L', 'L', 'R', 'P', 'L', 'Y'};
+static constexpr std::uint32_t       kReplayLogVersion = 1;
+
+// Default count of ticks between state hashes
+static constexpr int kInitReplayHashPeriodInTicks = 100;
+
+// Replay log header (snapshot of given size follows it)
+struct ReplayLogHeader {
+  std::array<char, 8> magic;
+  std::uint32_t       version;
+  std::uint32_t       byteOrderMark;
+  std::int32_t        hashPeriodInTicks;
+  std::int32_t        padding;
+  std::uint64_t       snapshotSize;
+};
+
+// Replay log record type enumeration
+enum class ReplayRecordTypes {
+  // Parameters are changed before the tick
+  Parameters,
+  // State hash after the tick
+  StateHash,
+  Size
+};
+
+// Replay log record (tick is count of ticks computed since recording started)
+struct ReplayRecord {
+  std::int64_t       tick;
+  std::int32_t       type;
+  std::int32_t       padding;
+  std::uint64_t      stateHash;
+  SnapshotParameters parameters;
+};
+
+// Class for recording replay log of simulation while it runs
+class ReplayRecorder {
+ private:
+  std::ofstream _file{};
+  int           _hashPeriodInTicks{};
+
+  // Count of recorded ticks and parameters recorded the last
+  long               _tick{};
+  SnapshotParameters _parameters{};
+
+ public:
+  ReplayRecorder() noexcept;
+
+  // Starts recording to file with snapshot of current state of simulation
+  int open(const std::string &filename, const CellController &cellController,
+           int hashPeriodInTicks);
+  bool isOpen() const noexcept;
+
+  // Records parameters if they have been changed since the previous tick (call it before tick)
+  int recordParameters(const CellController &cellController);
+  // Records state hash at the end of each hash period (call it after tick)
+  int recordTick(const CellController &cellController);
+};
+
+// Replays log with given simulation and returns the first tick whose state hash differs
+// from recorded one (-1 if all of them are the same) and count of compared hashes
+int replayLog(const std::string &filename, CellController &cellController, long &divergedTick,
+              long &hashCount);
+
+static_assert(std::is_trivially_copyable_v<ReplayRecord>);
+static_assert(sizeof(ReplayLogHeader) % sizeof(std::uint64_t) == 0);
+static_assert(sizeof(ReplayRecord) % sizeof(std::uint64_t) == 0);
+
+}
+
+#endif
@@ -0,0 +1,231 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Header file
+#include "./simulation_thread.hpp"
+
+// STD
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+// Flag of middle frame state set when middle frame is published and not taken yet
+static constexpr int kNewFrameFlag = 1 << 2;
+// Mask of middle frame state with index of middle frame
+static constexpr int kFrameIndexMask = kNewFrameFlag - 1;
+
+// Texture data of slot is put to region of rendering data storage instead of rendering data
+static_assert(sizeof(cellarium::CellController::CellTextureData) <=
+              sizeof(cellarium::CellController::CellRenderingData));
+
+SimulationThread::SimulationThread(cellarium::CellController                    &cellController,
+                                   cellarium::ReplayRecorder                    *replayRecorder,
+                                   const SimulationSettings                     &settings,
+                                   cellarium::CellController::CellRenderingData *cellRenderingData,
+                                   std::function<void(int)>                     releaseFrame)
+    : _cellController{cellController},
+      _replayRecorder{replayRecorder},
+      _backFrameIndex{0},
+      _middleFrameState{1},
+      _frontFrameIndex{2},
+      _releaseFrame{std::move(releaseFrame)},
+      _settings{settings} {
+  // Assigning regions of rendering data storage for all the cells to frames
+  const size_t maxCellCount{static_cast<size_t>(_cellController.getColumns()) *
+                            static_cast<size_t>(_cellController.getRows())};
+  for (int i = 0; i < kFrameCount; ++i) {
+    _frames[i].index             = i;
+    _frames[i].cellRenderingData = cellRenderingData + maxCellCount * static_cast<size_t>(i);
+    _frames[i].changedRows.resize(_cellController.getRows());
+  }
+  _pendingChangedRows.resize(_cellController.getRows());
+  _freshChangedRows.resize(_cellController.getRows());
+
+  // Publishing frame of initial state so there is a frame before the first tick
+  publishFrame(_settings);
+
+  // Starting simulation thread
+  _thread = std::thread{&SimulationThread::run, this};
+}
+
+SimulationThread::~SimulationThread() noexcept { stop(); }
+
+void SimulationThread::stop() noexcept {
+  // Skipping if simulation thread is already stopped
+  if (!_thread.joinable()) {
+    return;
+  }
+
+  // Waking simulation thread up to stop
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _isStopping = true;
+  }
+  _condition.notify_one();
+
+  // Waiting for simulation thread to finish current tick
+  _thread.join();
+}
+
+const SimulationFrame &SimulationThread::getFrame() noexcept {
+  // Taking middle frame if it is new and giving front one in exchange
+  // (only this thread takes frames, so the new one cannot be taken after the check)
+  if ((_middleFrameState.load(std::memory_order_relaxed) & kNewFrameFlag) != 0) {
+    _releaseFrame(_frontFrameIndex);
+    _frontFrameIndex =
+        _middleFrameState.exchange(_frontFrameIndex, std::memory_order_acq_rel) & kFrameIndexMask;
+  }
+
+  return _frames[_frontFrameIndex];
+}
+
+void SimulationThread::setSettings(const SimulationSettings &settings) {
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    // Skipping if settings are the same (they are set each rendered frame)
+    if (settings.cellRenderingMode == _settings.cellRenderingMode &&
+        settings.ticksPerRender == _settings.ticksPerRender &&
+        settings.enableRendering == _settings.enableRendering &&
+        settings.enableTextureRendering == _settings.enableTextureRendering &&
+        settings.enablePause == _settings.enablePause) {
+      return;
+    }
+
+    _settings           = settings;
+    _areSettingsChanged = true;
+  }
+  _condition.notify_one();
+}
+
+void SimulationThread::requestTick() {
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _isTickRequested = true;
+  }
+  _condition.notify_one();
+}
+
+void SimulationThread::setParameters(const cellarium::SnapshotParameters &parameters) {
+  pushCommand([parameters](cellarium::CellController &cellController) {
+    cellController.setParameters(parameters);
+  });
+}
+
+void SimulationThread::selectCell(int column, int row) {
+  pushCommand([column, row](cellarium::CellController &cellController) {
+    cellController.selectCell(column, row);
+  });
+}
+
+void SimulationThread::run() {
+  std::vector<std::function<void(cellarium::CellController &)>> commands{};
+  int                                                           ticksPassed{};
+
+  while (true) {
+    // Waiting for unpausing, tick request, commands or changed settings and taking them
+    SimulationSettings settings{};
+    bool               areSettingsChanged{};
+    bool               shouldAct{};
+    {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _condition.wait(lock, [this]() {
+        return _isStopping || !_settings.enablePause || _isTickRequested || !_commands.empty() ||
+               _areSettingsChanged;
+      });
+      if (_isStopping) {
+        return;
+      }
+
+      commands.swap(_commands);
+      settings            = _settings;
+      areSettingsChanged  = _areSettingsChanged;
+      shouldAct           = !_settings.enablePause || _isTickRequested;
+      _areSettingsChanged = false;
+      _isTickRequested    = false;
+    }
+
+    // Applying changes between ticks
+    for (const std::function<void(cellarium::CellController &)> &command : commands) {
+      command(_cellController);
+    }
+
+    // Computing next simulation tick recording it if needed
+    if (shouldAct) {
+      if (_replayRecorder != nullptr) {
+        _replayRecorder->recordParameters(_cellController);
+      }
+
+      _cellController.act();
+      ++ticksPassed;
+
+      if (_replayRecorder != nullptr) {
+        _replayRecorder->recordTick(_cellController);
+      }
+    }
+
+    // Publishing frame after each ticksPerRender ticks or if anything else visible has changed
+    if (settings.enableRendering &&
+        (ticksPassed >= settings.ticksPerRender || (shouldAct && settings.enablePause) ||
+         !commands.empty() || areSettingsChanged)) {
+      publishFrame(settings);
+      ticksPassed = 0;
+    }
+
+    commands.clear();
+  }
+}
+
+void SimulationThread::publishFrame(const SimulationSettings &settings) {
+  // Filling back frame
+  SimulationFrame &frame    = _frames[_backFrameIndex];
+  frame.number              = ++_frameNumber;
+  frame.cellCount           = static_cast<int>(_cellController.getCellCount());
+  frame.isRenderedToTexture = settings.enableTextureRendering;
+  if (frame.isRenderedToTexture) {
+    // Rendering rows changed since the previous frame (all the rows if it is not rendered
+    // to texture) and rows which may still be missing in texture (frames with them may have
+    // been replaced before rendering took them), cell rendering mode is applied by shader
+    const bool renderAllRows = !_isPreviousFrameRenderedToTexture;
+    std::fill(_freshChangedRows.begin(), _freshChangedRows.end(), renderAllRows ? 1 : 0);
+    _cellController.takeChangedRows(_freshChangedRows.data());
+    for (size_t row = 0; row < frame.changedRows.size(); ++row) {
+      frame.changedRows[row] = _freshChangedRows[row] | _pendingChangedRows[row];
+    }
+    _cellController.renderTexture(
+        reinterpret_cast<cellarium::CellController::CellTextureData *>(frame.cellRenderingData),
+        frame.changedRows.data());
+  } else {
+    _cellController.render(frame.cellRenderingData, settings.cellRenderingMode);
+  }
+  frame.statistics         = _cellController.getSimulationStatistics();
+  frame.sunPosition        = _cellController.getSunPosition();
+  frame.daytimeWidth       = _cellController.getDaytimeWidth();
+  frame.selectedCellExists = _cellController.getSelectedCell(frame.selectedCell);
+  _isPreviousFrameRenderedToTexture = frame.isRenderedToTexture;
+
+  // Exchanging back frame with middle one marking it as new
+  const int publishedFrameIndex = _backFrameIndex;
+  const int previousMiddleFrameState =
+      _middleFrameState.exchange(_backFrameIndex | kNewFrameFlag, std::memory_order_acq_rel);
+  _backFrameIndex = previousMiddleFrameState & kFrameIndexMask;
+
+  // Keeping rows which the next frame has to render too: if previous frame has been taken,
+  // texture misses only rows changed since it, otherwise it misses all the rows of this frame
+  if ((previousMiddleFrameState & kNewFrameFlag) == 0) {
+    _pendingChangedRows.swap(_freshChangedRows);
+  } else {
+    _pendingChangedRows = _frames[publishedFrameIndex].changedRows;
+  }
+}
+
+void SimulationThread::pushCommand(std::function<void(cellarium::CellController &)> command) {
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _commands.push_back(std::move(command));
+  }
+  _condition.notify_one();
+}
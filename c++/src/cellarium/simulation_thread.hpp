@@ -0,0 +1,141 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef SIMULATION_THREAD_HPP
+#define SIMULATION_THREAD_HPP
+
+// STD
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// CellController
+#include "./cell_controller.hpp"
+
+// ReplayRecorder
+#include "./replay_log.hpp"
+
+// Simulation state published by simulation thread for rendering
+struct SimulationFrame {
+  // Index of frame (and of region of rendering data storage it uses)
+  // and number of frame (frames are numbered in order they are published)
+  int index{};
+  int number{};
+
+  // Rendering data of all the cells (only the first cellCount elements are filled)
+  // or texture data of all the slots if frame is rendered to texture
+  cellarium::CellController::CellRenderingData *cellRenderingData{};
+  int                                           cellCount{};
+  bool                                          isRenderedToTexture{};
+  // Flags of rows rendered to texture (the others have not changed since a frame already taken
+  // by rendering, so only flagged rows have to be uploaded)
+  std::vector<std::uint8_t> changedRows{};
+
+  cellarium::CellController::Statistics statistics{};
+
+  float sunPosition{};
+  float daytimeWidth{};
+
+  cellarium::Cell selectedCell{};
+  bool            selectedCellExists{};
+};
+
+// Controls the simulation thread depends on
+struct SimulationSettings {
+  int  cellRenderingMode{};
+  int  ticksPerRender{};
+  bool enableRendering{};
+  bool enableTextureRendering{};
+  bool enablePause{};
+};
+
+// Thread computing simulation ticks independently of rendering
+//
+// Frames are published through a triple buffer, so simulation never waits for rendering
+// and rendering always gets the latest complete frame. Changes of simulation (parameters,
+// cell selection) are queued and applied between ticks.
+//
+// Rendering data is written to storage given by rendering (e.g. persistently mapped buffer),
+// so front frame is released by rendering callback before simulation thread may reuse it.
+class SimulationThread {
+ public:
+  // Count of frames and regions of rendering data storage
+  static constexpr int kFrameCount = 3;
+
+ private:
+  cellarium::CellController &_cellController;
+  cellarium::ReplayRecorder *_replayRecorder{};
+
+  // Frames are written to back one, exchanged with middle one when complete
+  // and middle one is exchanged with front one when it is new and rendering asks for a frame
+  std::array<SimulationFrame, kFrameCount> _frames{};
+  int                                      _backFrameIndex{};
+  std::atomic<int>                         _middleFrameState{};
+  int                                      _frontFrameIndex{};
+  std::function<void(int)>                 _releaseFrame{};
+  int                                      _frameNumber{};
+
+  // Flags of rows changed since the last frame known to be taken by rendering
+  // (they are rendered to texture in the next frame too) and since the previous frame
+  std::vector<std::uint8_t> _pendingChangedRows{};
+  std::vector<std::uint8_t> _freshChangedRows{};
+  bool                      _isPreviousFrameRenderedToTexture{};
+
+  // Queued changes, settings and requests guarded by mutex
+  std::mutex                                                    _mutex{};
+  std::condition_variable                                       _condition{};
+  std::vector<std::function<void(cellarium::CellController &)>> _commands{};
+  SimulationSettings                                            _settings{};
+  bool                                                          _areSettingsChanged{};
+  bool                                                          _isTickRequested{};
+  bool                                                          _isStopping{};
+
+  std::thread _thread{};
+
+ public:
+  // Publishes frame of current state and starts computing ticks (replay recorder may be null,
+  // rendering data storage has kFrameCount regions of columns * rows elements,
+  // releaseFrame is called with index of front frame before it is given back to simulation)
+  SimulationThread(cellarium::CellController                    &cellController,
+                   cellarium::ReplayRecorder                    *replayRecorder,
+                   const SimulationSettings                     &settings,
+                   cellarium::CellController::CellRenderingData *cellRenderingData,
+                   std::function<void(int)>                     releaseFrame);
+  SimulationThread(const SimulationThread &simulationThread) = delete;
+  SimulationThread &operator=(const SimulationThread &simulationThread) = delete;
+  SimulationThread(SimulationThread &&simulationThread)                 = delete;
+  SimulationThread &operator=(SimulationThread &&simulationThread) = delete;
+  ~SimulationThread() noexcept;
+
+  // Stops simulation thread after current tick (frames are not published after that)
+  void stop() noexcept;
+
+  // Returns the latest published frame (it is valid until the next call)
+  const SimulationFrame &getFrame() noexcept;
+
+  // Updates settings and requests one tick (while simulation is paused)
+  void setSettings(const SimulationSettings &settings);
+  void requestTick();
+
+  // Queue changes of simulation applied before the next tick
+  void setParameters(const cellarium::SnapshotParameters &parameters);
+  void selectCell(int column, int row);
+
+ private:
+  // Computes ticks and publishes frames until the thread is stopped
+  void run();
+  // Fills back frame and exchanges it with middle one
+  void publishFrame(const SimulationSettings &settings);
+  // Queues change of simulation and wakes simulation thread up
+  void pushCommand(std::function<void(cellarium::CellController &)> command);
+};
+
+#endif
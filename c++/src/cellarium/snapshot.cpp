@@ -0,0 +1,89 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Header file
+#include "./snapshot.hpp"
+
+// STD
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+// Using header file namespace
+using namespace cellarium;
+
+std::uint64_t cellarium::calculateSnapshotChecksum(const std::uint8_t *data,
+                                                   std::size_t         size) noexcept {
+  static constexpr std::uint64_t kOffsetBasis = 14695981039346656037ull;
+  static constexpr std::uint64_t kPrime       = 1099511628211ull;
+
+  std::uint64_t checksum{kOffsetBasis};
+  for (std::size_t i = 0; i < size; ++i) {
+    checksum = (checksum ^ data[i]) * kPrime;
+  }
+
+  return checksum;
+}
+
+SnapshotHeader cellarium::getSnapshotHeader(const std::vector<std::uint8_t> &snapshot) noexcept {
+  SnapshotHeader header{};
+  std::memcpy(&header, snapshot.data(), sizeof(SnapshotHeader));
+
+  return header;
+}
+
+int cellarium::readSnapshotFile(const std::string &filename, std::vector<std::uint8_t> &snapshot) {
+  // Opening snapshot file
+  std::ifstream snapshotFile{filename, std::ios::binary | std::ios::ate};
+  if (!snapshotFile.is_open()) {
+    std::cout << "error: cannot open " << filename << std::endl;
+    return -1;
+  }
+
+  // Reading whole snapshot at once
+  snapshot.resize(static_cast<std::size_t>(snapshotFile.tellg()));
+  snapshotFile.seekg(0);
+  snapshotFile.read(reinterpret_cast<char *>(snapshot.data()),
+                    static_cast<std::streamsize>(snapshot.size()));
+  if (!snapshotFile) {
+    std::cout << "error: cannot read " << filename << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+int cellarium::writeSnapshotFile(const std::string               &filename,
+                                 const std::vector<std::uint8_t> &snapshot) {
+  // Writing snapshot to temporary file
+  const std::string temporaryFilename{filename + ".tmp"};
+  {
+    std::ofstream snapshotFile{temporaryFilename, std::ios::binary | std::ios::trunc};
+    if (!snapshotFile.is_open()) {
+      std::cout << "error: cannot create " << temporaryFilename << std::endl;
+      return -1;
+    }
+
+    snapshotFile.write(reinterpret_cast<const char *>(snapshot.data()),
+                       static_cast<std::streamsize>(snapshot.size()));
+    snapshotFile.close();
+    if (!snapshotFile) {
+      std::cout << "error: cannot write " << temporaryFilename << std::endl;
+      return -1;
+    }
+  }
+
+  // Replacing snapshot file with temporary one (renaming fails on Windows if file exists)
+  if (std::rename(temporaryFilename.c_str(), filename.c_str()) != 0 &&
+      (std::remove(filename.c_str()) != 0 ||
+       std::rename(temporaryFilename.c_str(), filename.c_str()) != 0)) {
+    std::cout << "error: cannot replace " << filename << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
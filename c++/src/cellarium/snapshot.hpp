@@ -0,0 +1,175 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Binary snapshot format of CellController (see CellController::saveSnapshot())
+//
+// Snapshot is a header followed by sections at offsets listed in it. Sections are aligned
+// and consist of fixed-size records in native byte order, so snapshot can be memory-mapped
+// and loaded in one pass without parsing. Snapshots with other format version or byte order
+// are rejected.
+//
+// Delta snapshot has the same layout but keeps only grid slots changed since its parent
+// snapshot (full or delta one) was saved, so it can only be applied to state of its parent.
+
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+// STD
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace cellarium {
+
+// Snapshot and delta snapshot signatures, format version and value written in native byte order
+static constexpr std::array<char, 8> kSnapshotMagic{'C', 'E', 'L', 'L', 'S', 'N', 'A', 'P'};
+static constexpr std::array<char, 8> kDeltaSnapshotMagic{'C', 'E', 'L', 'L', 'D', 'L', 'T', 'A'};
+static constexpr std::uint32_t       kSnapshotVersion       = 2;
+static constexpr std::uint32_t       kSnapshotByteOrderMark = 0x01020304u;
+
+// Alignment of snapshot sections
+static constexpr std::uint64_t kSnapshotSectionAlignment = 8;
+
+// Count of enabling flags stored as bits in SnapshotParameters::enablingFlags
+static constexpr int kSnapshotEnablingFlagCount = 22;
+
+// Snapshot section enumeration (in file order)
+enum class SnapshotSections {
+  // SnapshotWorld record
+  World,
+  // Textual state of std::mt19937 (as written by operator<<)
+  RandomEngine,
+  // SnapshotCell record of each cell in computing order
+  // (of each changed occupied slot in index order in delta snapshot)
+  Cells,
+  // Genomes of cells having SnapshotCell::hasGenome set in the same order
+  // (8-bit genes if genes are packed, 32-bit otherwise)
+  Genomes,
+  // 32-bit indices of all cells in computing order (in delta snapshot only)
+  CellOrder,
+  // 32-bit indices of changed slots which are not occupied (in delta snapshot only)
+  ClearedSlots,
+  Size
+};
+
+// Offset from the beginning of snapshot and size of section in bytes
+struct SnapshotSection {
+  std::uint64_t offset;
+  std::uint64_t size;
+};
+
+// Snapshot header
+struct SnapshotHeader {
+  std::array<char, 8> magic;
+  std::uint32_t       version;
+  std::uint32_t       byteOrderMark;
+  std::uint64_t       snapshotSize;
+  // Checksums of everything after header and of parent snapshot (zero if it is full snapshot)
+  std::uint64_t checksum;
+  std::uint64_t parentChecksum;
+
+  std::array<SnapshotSection, static_cast<int>(SnapshotSections::Size)> sections;
+};
+
+// Simulation parameters which can be changed while simulation runs (in GUI, for example)
+// (enabling flags are bits in CellController::Params declaration order)
+struct SnapshotParameters {
+  std::int32_t maxInstructionsPerTick;
+  std::int32_t maxAkinGenomDifference;
+  std::int32_t minChildEnergy;
+  std::int32_t maxEnergy;
+  std::int32_t maxBurstOfPhotosynthesisEnergy;
+  std::int32_t maxPhotosynthesisDepth;
+  float        summerDaytimeToWholeDayRatio;
+  std::int32_t maxMinerals;
+  std::int32_t maxBurstOfMinerals;
+  float        energyPerMineral;
+  std::int32_t maxMineralHeight;
+  std::int32_t maxBurstOfFoodEnergy;
+  float        childBudMutationChance;
+  float        parentBudMutationChance;
+  float        randomMutationChance;
+  std::int32_t dayDurationInTicks;
+  std::int32_t seasonDurationInDays;
+  std::int32_t gammaFlashPeriodInDays;
+  std::int32_t gammaFlashMaxMutationsCount;
+
+  std::uint32_t enablingFlags;
+
+  std::int32_t genomeInterpreter;
+};
+
+// Simulation parameters, time and statistics counters
+struct SnapshotWorld {
+  std::int64_t countOfBuds;
+  std::int64_t countOfPhotosynthesisEnergyBursts;
+  std::int64_t countOfMineralEnergyBursts;
+  std::int64_t countOfFoodEnergyBursts;
+
+  std::uint32_t randomSeed;
+
+  std::int32_t columns;
+  std::int32_t rows;
+
+  std::int32_t genomeSize;
+
+  SnapshotParameters parameters;
+
+  std::int32_t threadCount;
+  std::int32_t tileWidth;
+  std::int32_t tileHeight;
+
+  std::int32_t ticksNumber;
+  std::int32_t yearsNumber;
+
+  std::int32_t countOfLiveCells;
+  std::int32_t countOfDeadCells;
+
+  std::int32_t cellCount;
+  std::int32_t areGenesPacked;
+};
+
+// Cell properties
+struct SnapshotCell {
+  std::int32_t index;
+  std::int32_t counter;
+  std::int32_t energy;
+  std::int32_t minerals;
+  std::int32_t direction;
+  std::int32_t age;
+  std::int32_t colorR;
+  std::int32_t colorG;
+  std::int32_t colorB;
+  std::int32_t energyShareBalance;
+  float        lastEnergyShare;
+  std::uint8_t isAlive;
+  std::uint8_t isPinned;
+  std::uint8_t hasGenome;
+  std::uint8_t padding;
+};
+
+// Returns FNV-1a hash of data (detects corrupted snapshots before anything is allocated)
+std::uint64_t calculateSnapshotChecksum(const std::uint8_t *data, std::size_t size) noexcept;
+
+// Returns header of snapshot (it must be at least of header size)
+SnapshotHeader getSnapshotHeader(const std::vector<std::uint8_t> &snapshot) noexcept;
+
+// Reads whole snapshot file and writes snapshot file replacing existing one only when it is
+// completely written (so interrupted writing does not spoil the previous snapshot)
+int readSnapshotFile(const std::string &filename, std::vector<std::uint8_t> &snapshot);
+int writeSnapshotFile(const std::string &filename, const std::vector<std::uint8_t> &snapshot);
+
+static_assert(std::is_trivially_copyable_v<SnapshotHeader>);
+static_assert(sizeof(SnapshotHeader) % kSnapshotSectionAlignment == 0);
+static_assert(sizeof(SnapshotWorld) % kSnapshotSectionAlignment == 0);
+static_assert(sizeof(SnapshotCell) % sizeof(std::int32_t) == 0);
+
+}
+
+#endif
@@ -0,0 +1,188 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// End-to-end benchmark of simulation ticks and rendering data filling driven by presets
+
+// STD
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Qt
+#include <QByteArray>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QString>
+#include <QStringList>
+
+// "cellarium" configuration loading
+#include <cellarium/configuration.hpp>
+
+// CellController
+#include <cellarium/cell_controller.hpp>
+
+// Benchmark parameters
+static constexpr unsigned int kRandomSeed           = 0;
+static constexpr int          kWarmUpPeriodInTicks  = 500;
+static constexpr int          kMinWarmUpTicks       = 2000;
+static constexpr int          kMaxWarmUpTicks       = 20000;
+static constexpr double       kSteadyStateTolerance = 0.05;
+static constexpr int          kMeasuredTicks        = 2000;
+static constexpr int          kCellRenderingMode    = 0;
+
+// Computes ticks until mean count of live cells of two consequent periods is almost the same
+// and returns count of computed ticks (population is steady if it is less than maximum)
+static int warmUp(cellarium::CellController &cellController) {
+  double prevMeanLiveCellCount{-1.0};
+
+  for (int ticks = 0; ticks < kMaxWarmUpTicks; ticks += kWarmUpPeriodInTicks) {
+    // Computing period and mean count of live cells of it
+    long liveCellCount{};
+    for (int i = 0; i < kWarmUpPeriodInTicks; ++i) {
+      cellController.act();
+      liveCellCount += cellController.getSimulationStatistics().countOfLiveCells;
+    }
+    const double meanLiveCellCount =
+        static_cast<double>(liveCellCount) / static_cast<double>(kWarmUpPeriodInTicks);
+
+    // Stopping if population is steady or extinct
+    if (ticks + kWarmUpPeriodInTicks >= kMinWarmUpTicks &&
+        std::abs(meanLiveCellCount - prevMeanLiveCellCount) <=
+            kSteadyStateTolerance * prevMeanLiveCellCount) {
+      return ticks + kWarmUpPeriodInTicks;
+    }
+    prevMeanLiveCellCount = meanLiveCellCount;
+  }
+
+  return kMaxWarmUpTicks;
+}
+
+// Runs benchmark of one preset and returns its results
+static int runBenchmark(const QFileInfo &presetFileInfo, QJsonObject &resultJsonObject) {
+  // Loading preset with fixed random seed
+  QJsonObject                       configJsonObject{};
+  cellarium::CellController::Params cellControllerParams{};
+  if (readConfigurationFile(presetFileInfo.filePath(), configJsonObject) != 0 ||
+      loadCellControllerParams(configJsonObject, cellControllerParams) != 0) {
+    return -1;
+  }
+  cellControllerParams.mersenneTwisterEngine = std::mt19937{kRandomSeed};
+  cellControllerParams.randomSeed            = kRandomSeed;
+
+  // Initializing simulation and rendering data buffer for all the cells
+  cellarium::CellController                                 cellController{cellControllerParams};
+  std::vector<cellarium::CellController::CellRenderingData> cellRenderingData(
+      static_cast<size_t>(cellController.getColumns()) * cellController.getRows());
+  // Flags of cell texture rows changed since the previous tick
+  std::vector<std::uint8_t> changedRows(static_cast<size_t>(cellController.getRows()));
+
+  std::cerr << presetFileInfo.baseName().toStdString() << ": warming up" << std::endl;
+  const int warmUpTicks = warmUp(cellController);
+  cellController.takeChangedRows(changedRows.data());
+
+  // Measuring ticks and rendering data filling separately
+  std::cerr << presetFileInfo.baseName().toStdString() << ": measuring" << std::endl;
+  long                     cellTicks{};
+  std::chrono::nanoseconds actTime{};
+  std::chrono::nanoseconds renderTime{};
+  long                     changedRowCount{};
+  for (int i = 0; i < kMeasuredTicks; ++i) {
+    cellTicks += static_cast<long>(cellController.getCellCount());
+
+    const auto actStartTime = std::chrono::steady_clock::now();
+    cellController.act();
+    const auto renderStartTime = std::chrono::steady_clock::now();
+    cellController.render(cellRenderingData.data(), kCellRenderingMode);
+    const auto renderEndTime = std::chrono::steady_clock::now();
+
+    actTime    += renderStartTime - actStartTime;
+    renderTime += renderEndTime - renderStartTime;
+
+    // Counting rows of cell texture which would be uploaded if it was rendered each tick
+    std::fill(changedRows.begin(), changedRows.end(), 0);
+    cellController.takeChangedRows(changedRows.data());
+    changedRowCount += std::count(changedRows.begin(), changedRows.end(), 1);
+  }
+
+  const double actSeconds    = std::chrono::duration<double>(actTime).count();
+  const double renderSeconds = std::chrono::duration<double>(renderTime).count();
+
+  // Filling results
+  resultJsonObject.insert("preset", presetFileInfo.baseName());
+  resultJsonObject.insert("columns", cellController.getColumns());
+  resultJsonObject.insert("rows", cellController.getRows());
+  resultJsonObject.insert("warmUpTicks", warmUpTicks);
+  resultJsonObject.insert("isSteady", warmUpTicks < kMaxWarmUpTicks);
+  resultJsonObject.insert("measuredTicks", kMeasuredTicks);
+  resultJsonObject.insert("meanCellCount",
+                          static_cast<double>(cellTicks) / static_cast<double>(kMeasuredTicks));
+  resultJsonObject.insert("liveCellCount",
+                          cellController.getSimulationStatistics().countOfLiveCells);
+  resultJsonObject.insert("ticksPerSecond", static_cast<double>(kMeasuredTicks) / actSeconds);
+  resultJsonObject.insert("cellTicksPerSecond", static_cast<double>(cellTicks) / actSeconds);
+  resultJsonObject.insert("renderMicrosecondsPerTick",
+                          renderSeconds * 1e6 / static_cast<double>(kMeasuredTicks));
+  resultJsonObject.insert("changedTextureRowFraction",
+                          static_cast<double>(changedRowCount) /
+                              (static_cast<double>(kMeasuredTicks) * cellController.getRows()));
+
+  return 0;
+}
+
+// Usage: cellarium_bench [presets directory] [output file]
+int main(int argc, char *argv[]) {
+  // Getting presets directory and output file name
+  const QString presetsDirName{argc > 1 ? argv[1] : CELLARIUM_PRESETS_DIR};
+  const QString outputFileName{argc > 2 ? argv[2] : ""};
+
+  // Getting sorted list of presets
+  const QDir          presetsDir{presetsDirName};
+  const QFileInfoList presetFileInfoList{
+      presetsDir.entryInfoList(QStringList() << "*.json", QDir::Files, QDir::Name)};
+  if (presetFileInfoList.isEmpty()) {
+    std::cout << "error: there are no presets in " << presetsDirName.toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Running benchmarks
+  QJsonArray resultsJsonArray{};
+  for (const QFileInfo &presetFileInfo : presetFileInfoList) {
+    QJsonObject resultJsonObject{};
+    if (runBenchmark(presetFileInfo, resultJsonObject) != 0) {
+      return EXIT_FAILURE;
+    }
+    resultsJsonArray.append(resultJsonObject);
+  }
+
+  QJsonObject benchmarkJsonObject{};
+  benchmarkJsonObject.insert("randomSeed", static_cast<int>(kRandomSeed));
+  benchmarkJsonObject.insert("results", resultsJsonArray);
+  const QByteArray benchmarkJson{QJsonDocument{benchmarkJsonObject}.toJson()};
+
+  // Writing results to standard output if no output file specified
+  if (outputFileName.isEmpty()) {
+    std::cout << benchmarkJson.toStdString();
+    return EXIT_SUCCESS;
+  }
+
+  QFile outputFile{outputFileName};
+  if (!outputFile.open(QFile::WriteOnly | QFile::Text)) {
+    std::cout << "error: cannot create " << outputFileName.toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+  outputFile.write(benchmarkJson);
+
+  return EXIT_SUCCESS;
+}
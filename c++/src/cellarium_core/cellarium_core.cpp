@@ -0,0 +1,427 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Header file
+#include "./cellarium_core.h"
+
+// STD
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Qt
+#include <QByteArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonParseError>
+
+// "cellarium" configuration loading
+#include <cellarium/configuration.hpp>
+
+// CellController
+#include <cellarium/cell_controller.hpp>
+
+// Rendering data is filled directly to caller-owned buffer so layouts must be the same
+static_assert(sizeof(CellariumCellRenderingData) ==
+                  sizeof(cellarium::CellController::CellRenderingData),
+              "CellariumCellRenderingData and CellRenderingData sizes differ");
+static_assert(offsetof(CellariumCellRenderingData, index) ==
+                      offsetof(cellarium::CellController::CellRenderingData, index) &&
+                  offsetof(CellariumCellRenderingData, colorR) ==
+                      offsetof(cellarium::CellController::CellRenderingData, colorR) &&
+                  offsetof(CellariumCellRenderingData, colorG) ==
+                      offsetof(cellarium::CellController::CellRenderingData, colorG) &&
+                  offsetof(CellariumCellRenderingData, colorB) ==
+                      offsetof(cellarium::CellController::CellRenderingData, colorB),
+              "CellariumCellRenderingData and CellRenderingData layouts differ");
+
+// Simulation world
+struct CellariumWorld {
+  cellarium::CellController cellController;
+};
+
+// Count of cell directions (the same as CellController has)
+static constexpr int kDirectionCount = 8;
+
+// Returns whether parameter condition is met printing error if not
+static bool isParamValid(bool isValid, const char *error) {
+  if (!isValid) {
+    std::cout << "error: " << error << std::endl;
+  }
+
+  return isValid;
+}
+
+// Returns whether world can be created from parameters
+// (CellController divides by and allocates with them without checking)
+static bool areParamsValid(const cellarium::CellController::Params &params) {
+  const int columns = static_cast<int>(static_cast<float>(params.width) / params.cellSize);
+  const int rows    = static_cast<int>(static_cast<float>(params.height) / params.cellSize);
+
+  bool areGenesValid = !params.firstCellGenome.empty();
+  for (int gene : params.firstCellGenome) {
+    areGenesValid = areGenesValid && gene >= 0 && gene < params.genomeSize;
+  }
+
+  return isParamValid(params.width > 0 && params.height > 0, "width and height must be positive") &&
+         isParamValid(params.cellSize > 0.0f, "cellSize must be positive") &&
+         isParamValid(columns >= 1 && rows >= 1, "world must have at least one cell") &&
+         isParamValid(params.genomeSize >= 1, "genomeSize must be positive") &&
+         isParamValid(params.minChildEnergy >= 0 && params.maxEnergy >= 0 &&
+                          params.maxBurstOfPhotosynthesisEnergy >= 0 &&
+                          params.maxBurstOfFoodEnergy >= 0,
+                      "energy limits must not be negative") &&
+         isParamValid(params.maxMinerals >= 0 && params.maxBurstOfMinerals >= 0,
+                      "mineral limits must not be negative") &&
+         isParamValid(params.dayDurationInTicks >= 1 && params.seasonDurationInDays >= 1 &&
+                          params.gammaFlashPeriodInDays >= 1,
+                      "time periods must be positive") &&
+         isParamValid(static_cast<int>(params.genomeInterpreter) >= 0 &&
+                          params.genomeInterpreter < cellarium::GenomeInterpreters::Size,
+                      "genomeInterpreter is unknown") &&
+         isParamValid(areGenesValid,
+                      "firstCellGenome must not be empty and its genes must be in range "
+                      "[0, genomeSize)") &&
+         isParamValid(params.firstCellDirection >= 0 && params.firstCellDirection < kDirectionCount,
+                      "firstCellDirection must be in range [0, 8)") &&
+         isParamValid(params.firstCellIndexMultiplier >= 0.0f &&
+                          static_cast<int>(static_cast<float>(columns) *
+                                           params.firstCellIndexMultiplier) < columns * rows,
+                      "firstCellIndexMultiplier puts the first cell out of world");
+}
+
+// Creates world catching allocation and thread creation errors (they must not cross C API)
+static CellariumWorld *createWorld(const cellarium::CellController::Params &cellControllerParams) {
+  if (!areParamsValid(cellControllerParams)) {
+    return nullptr;
+  }
+
+  try {
+    return new CellariumWorld{cellarium::CellController{cellControllerParams}};
+  } catch (const std::exception &exception) {
+    std::cout << "error: cannot create world: " << exception.what() << std::endl;
+    return nullptr;
+  }
+}
+
+// Returns whether pointer passed to C API is null printing error if so
+static bool isNull(const void *pointer, const char *name) {
+  if (pointer == nullptr) {
+    std::cout << "error: " << name << " must not be NULL" << std::endl;
+    return true;
+  }
+
+  return false;
+}
+
+void cellariumGetDefaultParams(CellariumParams *params) {
+  if (isNull(params, "params")) {
+    return;
+  }
+
+  // Default first cell genome (owned by library)
+  static const std::vector<int> kDefaultFirstCellGenome{cellarium::kInitFirstCellGenome};
+
+  const cellarium::CellController::Params cellControllerParams{};
+
+  params->randomSeed                       = cellControllerParams.randomSeed;
+  params->width                            = cellControllerParams.width;
+  params->height                           = cellControllerParams.height;
+  params->cellSize                         = cellControllerParams.cellSize;
+  params->maxPhotosynthesisDepthMultiplier = cellControllerParams.maxPhotosynthesisDepthMultiplier;
+  params->maxMineralHeightMultiplier       = cellControllerParams.maxMineralHeightMultiplier;
+  params->genomeSize                       = cellControllerParams.genomeSize;
+  params->maxInstructionsPerTick           = cellControllerParams.maxInstructionsPerTick;
+  params->maxAkinGenomDifference           = cellControllerParams.maxAkinGenomDifference;
+  params->minChildEnergy                   = cellControllerParams.minChildEnergy;
+  params->maxEnergy                        = cellControllerParams.maxEnergy;
+  params->maxBurstOfPhotosynthesisEnergy   = cellControllerParams.maxBurstOfPhotosynthesisEnergy;
+  params->summerDaytimeToWholeDayRatio     = cellControllerParams.summerDaytimeToWholeDayRatio;
+  params->maxMinerals                      = cellControllerParams.maxMinerals;
+  params->maxBurstOfMinerals               = cellControllerParams.maxBurstOfMinerals;
+  params->energyPerMineral                 = cellControllerParams.energyPerMineral;
+  params->maxBurstOfFoodEnergy             = cellControllerParams.maxBurstOfFoodEnergy;
+  params->childBudMutationChance           = cellControllerParams.childBudMutationChance;
+  params->parentBudMutationChance          = cellControllerParams.parentBudMutationChance;
+  params->randomMutationChance             = cellControllerParams.randomMutationChance;
+  params->dayDurationInTicks               = cellControllerParams.dayDurationInTicks;
+  params->seasonDurationInDays             = cellControllerParams.seasonDurationInDays;
+  params->gammaFlashPeriodInDays           = cellControllerParams.gammaFlashPeriodInDays;
+  params->gammaFlashMaxMutationsCount      = cellControllerParams.gammaFlashMaxMutationsCount;
+  params->enableInstructionTurn            = cellControllerParams.enableInstructionTurn;
+  params->enableInstructionMove            = cellControllerParams.enableInstructionMove;
+  params->enableInstructionGetEnergyFromPhotosynthesis =
+      cellControllerParams.enableInstructionGetEnergyFromPhotosynthesis;
+  params->enableInstructionGetEnergyFromMinerals =
+      cellControllerParams.enableInstructionGetEnergyFromMinerals;
+  params->enableInstructionGetEnergyFromFood =
+      cellControllerParams.enableInstructionGetEnergyFromFood;
+  params->enableInstructionBud = cellControllerParams.enableInstructionBud;
+  params->enableInstructionMutateRandomGene =
+      cellControllerParams.enableInstructionMutateRandomGene;
+  params->enableInstructionShareEnergy = cellControllerParams.enableInstructionShareEnergy;
+  params->enableInstructionTouch       = cellControllerParams.enableInstructionTouch;
+  params->enableInstructionDetermineEnergyLevel =
+      cellControllerParams.enableInstructionDetermineEnergyLevel;
+  params->enableInstructionDetermineDepth = cellControllerParams.enableInstructionDetermineDepth;
+  params->enableInstructionDetermineBurstOfPhotosynthesisEnergy =
+      cellControllerParams.enableInstructionDetermineBurstOfPhotosynthesisEnergy;
+  params->enableInstructionDetermineBurstOfMinerals =
+      cellControllerParams.enableInstructionDetermineBurstOfMinerals;
+  params->enableInstructionDetermineBurstOfMineralEnergy =
+      cellControllerParams.enableInstructionDetermineBurstOfMineralEnergy;
+  params->enableZeroEnergyOrganic = cellControllerParams.enableZeroEnergyOrganic;
+  params->enableForcedBuddingOnMaximalEnergyLevel =
+      cellControllerParams.enableForcedBuddingOnMaximalEnergyLevel;
+  params->enableTryingToBudInUnoccupiedDirection =
+      cellControllerParams.enableTryingToBudInUnoccupiedDirection;
+  params->enableDeathOnBuddingIfNotEnoughSpace =
+      cellControllerParams.enableDeathOnBuddingIfNotEnoughSpace;
+  params->enableSeasons              = cellControllerParams.enableSeasons;
+  params->enableDaytimes             = cellControllerParams.enableDaytimes;
+  params->enableMaximizingFoodEnergy = cellControllerParams.enableMaximizingFoodEnergy;
+  params->enableDeadCellPinningOnSinking = cellControllerParams.enableDeadCellPinningOnSinking;
+  params->firstCellGenome                = kDefaultFirstCellGenome.data();
+  params->firstCellGenomeSize            = static_cast<int>(kDefaultFirstCellGenome.size());
+  params->firstCellEnergyMultiplier      = cellControllerParams.firstCellEnergyMultiplier;
+  params->firstCellDirection             = cellControllerParams.firstCellDirection;
+  params->firstCellIndexMultiplier       = cellControllerParams.firstCellIndexMultiplier;
+  params->genomeInterpreter = static_cast<int>(cellControllerParams.genomeInterpreter);
+  params->threadCount       = cellControllerParams.threadCount;
+  params->tileWidth         = cellControllerParams.tileWidth;
+  params->tileHeight        = cellControllerParams.tileHeight;
+}
+
+CellariumWorld *cellariumCreateWorld(const CellariumParams *params) {
+  if (isNull(params, "params")) {
+    return nullptr;
+  }
+
+  // Genes are checked with the other parameters after they are copied
+  // (they must be in [0, genomeSize) like mutated ones so they can be stored packed)
+  if (params->firstCellGenomeSize < 1 || params->firstCellGenome == nullptr) {
+    std::cout << "error: firstCellGenome must not be empty" << std::endl;
+    return nullptr;
+  }
+
+  cellarium::CellController::Params cellControllerParams{};
+
+  cellControllerParams.mersenneTwisterEngine = std::mt19937{params->randomSeed};
+  cellControllerParams.randomSeed            = params->randomSeed;
+  cellControllerParams.width                 = params->width;
+  cellControllerParams.height                = params->height;
+  cellControllerParams.cellSize              = params->cellSize;
+  cellControllerParams.maxPhotosynthesisDepthMultiplier = params->maxPhotosynthesisDepthMultiplier;
+  cellControllerParams.maxMineralHeightMultiplier       = params->maxMineralHeightMultiplier;
+  cellControllerParams.genomeSize                       = params->genomeSize;
+  cellControllerParams.maxInstructionsPerTick           = params->maxInstructionsPerTick;
+  cellControllerParams.maxAkinGenomDifference           = params->maxAkinGenomDifference;
+  cellControllerParams.minChildEnergy                   = params->minChildEnergy;
+  cellControllerParams.maxEnergy                        = params->maxEnergy;
+  cellControllerParams.maxBurstOfPhotosynthesisEnergy   = params->maxBurstOfPhotosynthesisEnergy;
+  cellControllerParams.summerDaytimeToWholeDayRatio     = params->summerDaytimeToWholeDayRatio;
+  cellControllerParams.maxMinerals                      = params->maxMinerals;
+  cellControllerParams.maxBurstOfMinerals               = params->maxBurstOfMinerals;
+  cellControllerParams.energyPerMineral                 = params->energyPerMineral;
+  cellControllerParams.maxBurstOfFoodEnergy             = params->maxBurstOfFoodEnergy;
+  cellControllerParams.childBudMutationChance           = params->childBudMutationChance;
+  cellControllerParams.parentBudMutationChance          = params->parentBudMutationChance;
+  cellControllerParams.randomMutationChance             = params->randomMutationChance;
+  cellControllerParams.dayDurationInTicks               = params->dayDurationInTicks;
+  cellControllerParams.seasonDurationInDays             = params->seasonDurationInDays;
+  cellControllerParams.gammaFlashPeriodInDays           = params->gammaFlashPeriodInDays;
+  cellControllerParams.gammaFlashMaxMutationsCount      = params->gammaFlashMaxMutationsCount;
+  cellControllerParams.enableInstructionTurn            = params->enableInstructionTurn;
+  cellControllerParams.enableInstructionMove            = params->enableInstructionMove;
+  cellControllerParams.enableInstructionGetEnergyFromPhotosynthesis =
+      params->enableInstructionGetEnergyFromPhotosynthesis;
+  cellControllerParams.enableInstructionGetEnergyFromMinerals =
+      params->enableInstructionGetEnergyFromMinerals;
+  cellControllerParams.enableInstructionGetEnergyFromFood =
+      params->enableInstructionGetEnergyFromFood;
+  cellControllerParams.enableInstructionBud = params->enableInstructionBud;
+  cellControllerParams.enableInstructionMutateRandomGene =
+      params->enableInstructionMutateRandomGene;
+  cellControllerParams.enableInstructionShareEnergy = params->enableInstructionShareEnergy;
+  cellControllerParams.enableInstructionTouch       = params->enableInstructionTouch;
+  cellControllerParams.enableInstructionDetermineEnergyLevel =
+      params->enableInstructionDetermineEnergyLevel;
+  cellControllerParams.enableInstructionDetermineDepth = params->enableInstructionDetermineDepth;
+  cellControllerParams.enableInstructionDetermineBurstOfPhotosynthesisEnergy =
+      params->enableInstructionDetermineBurstOfPhotosynthesisEnergy;
+  cellControllerParams.enableInstructionDetermineBurstOfMinerals =
+      params->enableInstructionDetermineBurstOfMinerals;
+  cellControllerParams.enableInstructionDetermineBurstOfMineralEnergy =
+      params->enableInstructionDetermineBurstOfMineralEnergy;
+  cellControllerParams.enableZeroEnergyOrganic = params->enableZeroEnergyOrganic;
+  cellControllerParams.enableForcedBuddingOnMaximalEnergyLevel =
+      params->enableForcedBuddingOnMaximalEnergyLevel;
+  cellControllerParams.enableTryingToBudInUnoccupiedDirection =
+      params->enableTryingToBudInUnoccupiedDirection;
+  cellControllerParams.enableDeathOnBuddingIfNotEnoughSpace =
+      params->enableDeathOnBuddingIfNotEnoughSpace;
+  cellControllerParams.enableSeasons              = params->enableSeasons;
+  cellControllerParams.enableDaytimes             = params->enableDaytimes;
+  cellControllerParams.enableMaximizingFoodEnergy = params->enableMaximizingFoodEnergy;
+  cellControllerParams.enableDeadCellPinningOnSinking = params->enableDeadCellPinningOnSinking;
+  cellControllerParams.firstCellGenome                = std::vector<int>(
+      params->firstCellGenome, params->firstCellGenome + params->firstCellGenomeSize);
+  cellControllerParams.firstCellEnergyMultiplier = params->firstCellEnergyMultiplier;
+  cellControllerParams.firstCellDirection        = params->firstCellDirection;
+  cellControllerParams.firstCellIndexMultiplier  = params->firstCellIndexMultiplier;
+  cellControllerParams.genomeInterpreter =
+      static_cast<cellarium::GenomeInterpreters>(params->genomeInterpreter);
+  cellControllerParams.threadCount = params->threadCount;
+  cellControllerParams.tileWidth   = params->tileWidth;
+  cellControllerParams.tileHeight  = params->tileHeight;
+
+  return createWorld(cellControllerParams);
+}
+
+CellariumWorld *cellariumCreateWorldFromJson(const char *json) {
+  if (isNull(json, "json")) {
+    return nullptr;
+  }
+
+  // Parsing configuration
+  QJsonParseError     jsonParseError{};
+  const QJsonDocument configJsonDocument{
+      QJsonDocument::fromJson(QByteArray{json}, &jsonParseError)};
+  if (jsonParseError.error != QJsonParseError::NoError || !configJsonDocument.isObject()) {
+    std::cout << "error: cannot parse configuration" << std::endl;
+    return nullptr;
+  }
+
+  // Updating default CellController::Params with configuration
+  cellarium::CellController::Params cellControllerParams{};
+  if (loadCellControllerParams(configJsonDocument.object(), cellControllerParams) != 0) {
+    return nullptr;
+  }
+
+  return createWorld(cellControllerParams);
+}
+
+void cellariumDestroyWorld(CellariumWorld *world) { delete world; }
+
+int cellariumStep(CellariumWorld *world, int tickCount) {
+  if (isNull(world, "world")) {
+    return -1;
+  }
+
+  try {
+    for (int i = 0; i < tickCount; ++i) {
+      world->cellController.act();
+    }
+  } catch (const std::exception &exception) {
+    std::cout << "error: cannot compute tick: " << exception.what() << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+void cellariumGetStatistics(const CellariumWorld *world, CellariumStatistics *statistics) {
+  if (isNull(world, "world") || isNull(statistics, "statistics")) {
+    return;
+  }
+
+  const cellarium::CellController::Statistics cellControllerStatistics{
+      world->cellController.getSimulationStatistics()};
+
+  statistics->tick                              = cellControllerStatistics.tick;
+  statistics->day                               = cellControllerStatistics.day;
+  statistics->year                              = cellControllerStatistics.year;
+  statistics->season                            = cellControllerStatistics.season;
+  statistics->daysToGammaFlash                  = cellControllerStatistics.daysToGammaFlash;
+  statistics->countOfLiveCells                  = cellControllerStatistics.countOfLiveCells;
+  statistics->countOfDeadCells                  = cellControllerStatistics.countOfDeadCells;
+  statistics->countOfBuds                       = cellControllerStatistics.countOfBuds;
+  statistics->countOfPhotosynthesisEnergyBursts =
+      cellControllerStatistics.countOfPhotosynthesisEnergyBursts;
+  statistics->countOfMineralEnergyBursts = cellControllerStatistics.countOfMineralEnergyBursts;
+  statistics->countOfFoodEnergyBursts    = cellControllerStatistics.countOfFoodEnergyBursts;
+}
+
+void cellariumGetCellGrid(const CellariumWorld *world, CellariumCellGrid *cellGrid) {
+  if (isNull(world, "world") || isNull(cellGrid, "cellGrid")) {
+    return;
+  }
+
+  const cellarium::CellController::CellGridView cellGridView{
+      world->cellController.getCellGridView()};
+
+  cellGrid->columns     = cellGridView.columns;
+  cellGrid->rows        = cellGridView.rows;
+  cellGrid->areOccupied = cellGridView.areOccupied;
+  cellGrid->areAlive    = cellGridView.areAlive;
+  cellGrid->energies    = cellGridView.energies;
+  cellGrid->minerals    = cellGridView.minerals;
+  cellGrid->directions  = cellGridView.directions;
+  cellGrid->ages        = cellGridView.ages;
+  cellGrid->colorsR     = cellGridView.colorsR;
+  cellGrid->colorsG     = cellGridView.colorsG;
+  cellGrid->colorsB     = cellGridView.colorsB;
+}
+
+int cellariumGetCellCount(const CellariumWorld *world) {
+  if (isNull(world, "world")) {
+    return -1;
+  }
+
+  return static_cast<int>(world->cellController.getCellCount());
+}
+
+int cellariumRender(CellariumWorld *world, CellariumCellRenderingData *buffer, int bufferSize,
+                    int cellRenderingMode) {
+  if (isNull(world, "world") || isNull(buffer, "buffer")) {
+    return -1;
+  }
+
+  // Checking if all the cells fit buffer
+  const int cellCount = static_cast<int>(world->cellController.getCellCount());
+  if (bufferSize < cellCount) {
+    return -1;
+  }
+
+  try {
+    world->cellController.render(
+        reinterpret_cast<cellarium::CellController::CellRenderingData *>(buffer),
+        cellRenderingMode);
+  } catch (const std::exception &exception) {
+    std::cout << "error: cannot render cells: " << exception.what() << std::endl;
+    return -1;
+  }
+
+  return cellCount;
+}
+
+int cellariumSaveSnapshot(const CellariumWorld *world, const char *filename) {
+  if (isNull(world, "world") || isNull(filename, "filename")) {
+    return -1;
+  }
+
+  try {
+    return world->cellController.saveSnapshotFile(filename);
+  } catch (const std::exception &exception) {
+    std::cout << "error: cannot save snapshot: " << exception.what() << std::endl;
+    return -1;
+  }
+}
+
+int cellariumLoadSnapshot(CellariumWorld *world, const char *filename) {
+  if (isNull(world, "world") || isNull(filename, "filename")) {
+    return -1;
+  }
+
+  try {
+    return world->cellController.loadSnapshotFile(filename);
+  } catch (const std::exception &exception) {
+    std::cout << "error: cannot load snapshot: " << exception.what() << std::endl;
+    return -1;
+  }
+}
@@ -0,0 +1,189 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// C API of cellarium simulation for running worlds in-process without window and GUI
+
+#ifndef CELLARIUM_CORE_H
+#define CELLARIUM_CORE_H
+
+// STD
+#include <stdbool.h>
+#include <stdint.h>
+
+// Exported function attribute
+#if defined(_WIN32)
+#if defined(CELLARIUM_CORE_EXPORTS)
+#define CELLARIUM_CORE_API __declspec(dllexport)
+#else
+#define CELLARIUM_CORE_API __declspec(dllimport)
+#endif
+#else
+#define CELLARIUM_CORE_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Simulation world (opaque)
+typedef struct CellariumWorld CellariumWorld;
+
+// Simulation parameters (the same as cellarium::CellController::Params and configuration file)
+typedef struct CellariumParams {
+  uint32_t randomSeed;
+
+  int   width;
+  int   height;
+  float cellSize;
+
+  float maxPhotosynthesisDepthMultiplier;
+  float maxMineralHeightMultiplier;
+
+  int   genomeSize;
+  int   maxInstructionsPerTick;
+  int   maxAkinGenomDifference;
+  int   minChildEnergy;
+  int   maxEnergy;
+  int   maxBurstOfPhotosynthesisEnergy;
+  float summerDaytimeToWholeDayRatio;
+  int   maxMinerals;
+  int   maxBurstOfMinerals;
+  float energyPerMineral;
+  int   maxBurstOfFoodEnergy;
+  float childBudMutationChance;
+  float parentBudMutationChance;
+  float randomMutationChance;
+  int   dayDurationInTicks;
+  int   seasonDurationInDays;
+  int   gammaFlashPeriodInDays;
+  int   gammaFlashMaxMutationsCount;
+
+  bool enableInstructionTurn;
+  bool enableInstructionMove;
+  bool enableInstructionGetEnergyFromPhotosynthesis;
+  bool enableInstructionGetEnergyFromMinerals;
+  bool enableInstructionGetEnergyFromFood;
+  bool enableInstructionBud;
+  bool enableInstructionMutateRandomGene;
+  bool enableInstructionShareEnergy;
+  bool enableInstructionTouch;
+  bool enableInstructionDetermineEnergyLevel;
+  bool enableInstructionDetermineDepth;
+  bool enableInstructionDetermineBurstOfPhotosynthesisEnergy;
+  bool enableInstructionDetermineBurstOfMinerals;
+  bool enableInstructionDetermineBurstOfMineralEnergy;
+
+  bool enableZeroEnergyOrganic;
+  bool enableForcedBuddingOnMaximalEnergyLevel;
+  bool enableTryingToBudInUnoccupiedDirection;
+  bool enableDeathOnBuddingIfNotEnoughSpace;
+  bool enableSeasons;
+  bool enableDaytimes;
+  bool enableMaximizingFoodEnergy;
+  bool enableDeadCellPinningOnSinking;
+
+  // Genes are copied on world creation so caller keeps ownership of the array
+  const int *firstCellGenome;
+  int        firstCellGenomeSize;
+  float      firstCellEnergyMultiplier;
+  int        firstCellDirection;
+  float      firstCellIndexMultiplier;
+
+  int genomeInterpreter;
+
+  int threadCount;
+  int tileWidth;
+  int tileHeight;
+} CellariumParams;
+
+// Simulation statistics
+typedef struct CellariumStatistics {
+  int tick;
+  int day;
+  int year;
+  int season;
+
+  int daysToGammaFlash;
+
+  int countOfLiveCells;
+  int countOfDeadCells;
+
+  int64_t countOfBuds;
+
+  int64_t countOfPhotosynthesisEnergyBursts;
+  int64_t countOfMineralEnergyBursts;
+  int64_t countOfFoodEnergyBursts;
+} CellariumStatistics;
+
+// View of cell property columns indexed by cell index (column + row * columns)
+// (pointers stay valid until world is destroyed or loads snapshot, values change with each step,
+// so cellariumGetCellGrid() must be called again after cellariumLoadSnapshot() succeeds)
+typedef struct CellariumCellGrid {
+  int columns;
+  int rows;
+
+  const uint8_t *areOccupied;
+  const uint8_t *areAlive;
+  const int     *energies;
+  const int     *minerals;
+  const int     *directions;
+  const int     *ages;
+  const int     *colorsR;
+  const int     *colorsG;
+  const int     *colorsB;
+} CellariumCellGrid;
+
+// Cell index and color for rendering (the same layout as CellController::CellRenderingData)
+typedef struct CellariumCellRenderingData {
+  int index;
+
+  float colorR;
+  float colorG;
+  float colorB;
+} CellariumCellRenderingData;
+
+// All the functions print error and do nothing (return NULL or -1) if world or output is NULL
+
+// Fills parameters with default values (default first cell genome array is owned by library)
+CELLARIUM_CORE_API void cellariumGetDefaultParams(CellariumParams *params);
+
+// Creates world from parameters or configuration file JSON text
+// (returns NULL on error or if parameters are out of range)
+CELLARIUM_CORE_API CellariumWorld *cellariumCreateWorld(const CellariumParams *params);
+CELLARIUM_CORE_API CellariumWorld *cellariumCreateWorldFromJson(const char *json);
+// Destroys world
+CELLARIUM_CORE_API void cellariumDestroyWorld(CellariumWorld *world);
+
+// Computes given count of simulation ticks (returns 0 on success and -1 on error)
+CELLARIUM_CORE_API int cellariumStep(CellariumWorld *world, int tickCount);
+
+// Fills simulation statistics
+CELLARIUM_CORE_API void cellariumGetStatistics(const CellariumWorld *world,
+                                               CellariumStatistics  *statistics);
+
+// Fills view of cell property columns without copying them
+CELLARIUM_CORE_API void cellariumGetCellGrid(const CellariumWorld *world,
+                                             CellariumCellGrid    *cellGrid);
+
+// Returns count of cells (live and dead ones) or -1 on error
+CELLARIUM_CORE_API int cellariumGetCellCount(const CellariumWorld *world);
+
+// Fills caller-owned buffer with rendering data of each cell in given rendering mode
+// (returns count of cells or -1 if buffer size is less than it or on error)
+CELLARIUM_CORE_API int cellariumRender(CellariumWorld *world, CellariumCellRenderingData *buffer,
+                                       int bufferSize, int cellRenderingMode);
+
+// Writes world snapshot to file and restores world from snapshot file
+// (return 0 on success and -1 on error keeping world unchanged,
+// successful restoring invalidates cell grid view)
+CELLARIUM_CORE_API int cellariumSaveSnapshot(const CellariumWorld *world, const char *filename);
+CELLARIUM_CORE_API int cellariumLoadSnapshot(CellariumWorld *world, const char *filename);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,79 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Test of cellarium_core C API rejecting invalid parameters instead of crashing
+
+// STD
+#include <stdio.h>
+
+// "cellarium_core" C API
+#include <cellarium_core.h>
+
+// Count of failed checks
+static int sFailCount = 0;
+
+// Checks that world is not created from default parameters with given fields changed
+#define CHECK_INVALID_PARAMS(assignments)                       \
+  {                                                             \
+    CellariumParams params;                                     \
+    cellariumGetDefaultParams(&params);                         \
+    assignments;                                                \
+    CellariumWorld *world = cellariumCreateWorld(&params);      \
+    if (world != NULL) {                                        \
+      printf("fail: world is created with %s\n", #assignments); \
+      cellariumDestroyWorld(world);                             \
+      ++sFailCount;                                             \
+    }                                                           \
+  }
+#define CHECK_INVALID_PARAM(field, value) CHECK_INVALID_PARAMS(params.field = value)
+
+int main(void) {
+  // Checking that world is created from default parameters and computes ticks
+  CellariumParams params;
+  cellariumGetDefaultParams(&params);
+  CellariumWorld *world = cellariumCreateWorld(&params);
+  if (world == NULL || cellariumStep(world, 10) != 0) {
+    printf("fail: world is not created from default parameters\n");
+    ++sFailCount;
+  }
+  cellariumDestroyWorld(world);
+
+  // Checking each invalid field
+  const int invalidGenome[] = {-1};
+  CHECK_INVALID_PARAM(width, 0);
+  CHECK_INVALID_PARAM(height, -1);
+  CHECK_INVALID_PARAM(cellSize, 0.0f);
+  CHECK_INVALID_PARAM(cellSize, 1000000.0f);
+  CHECK_INVALID_PARAM(genomeSize, 0);
+  CHECK_INVALID_PARAM(minChildEnergy, -1);
+  CHECK_INVALID_PARAM(maxEnergy, -1);
+  CHECK_INVALID_PARAM(maxBurstOfPhotosynthesisEnergy, -1);
+  CHECK_INVALID_PARAM(maxBurstOfFoodEnergy, -1);
+  CHECK_INVALID_PARAM(maxMinerals, -2);
+  CHECK_INVALID_PARAM(maxBurstOfMinerals, -1);
+  CHECK_INVALID_PARAM(dayDurationInTicks, 0);
+  CHECK_INVALID_PARAM(seasonDurationInDays, 0);
+  CHECK_INVALID_PARAM(gammaFlashPeriodInDays, 0);
+  CHECK_INVALID_PARAM(genomeInterpreter, -1);
+  CHECK_INVALID_PARAM(genomeInterpreter, 2);
+  CHECK_INVALID_PARAM(firstCellGenome, NULL);
+  CHECK_INVALID_PARAM(firstCellGenomeSize, 0);
+  CHECK_INVALID_PARAMS(params.firstCellGenome = invalidGenome; params.firstCellGenomeSize = 1);
+  CHECK_INVALID_PARAM(firstCellDirection, 8);
+  CHECK_INVALID_PARAM(firstCellIndexMultiplier, -1.0f);
+  CHECK_INVALID_PARAM(firstCellIndexMultiplier, 1000000.0f);
+
+  // Checking null pointers
+  if (cellariumCreateWorld(NULL) != NULL || cellariumCreateWorldFromJson(NULL) != NULL ||
+      cellariumStep(NULL, 1) != -1 || cellariumGetCellCount(NULL) != -1) {
+    printf("fail: null pointer is accepted\n");
+    ++sFailCount;
+  }
+
+  printf("%d checks failed\n", sFailCount);
+
+  return sFailCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// STD
+#include <algorithm>
+#include <cstring>
+#include <random>
+
+// Header file
+#include "./diff_engine.hpp"
+
+// CellController (of reference or current sources depending on include directories)
+#include <cellarium/cell.hpp>
+#include <cellarium/cell_controller.hpp>
+
+// Name of function creating engine (reference sources are compiled with definition)
+#ifdef CELLARIUM_DIFF_REFERENCE
+#define CELLARIUM_DIFF_ENGINE_FACTORY createReferenceDiffEngine
+#else
+#define CELLARIUM_DIFF_ENGINE_FACTORY createCandidateDiffEngine
+#endif
+
+#ifdef CELLARIUM_DIFF_REFERENCE
+// Cell properties of reference engine are private and only CellController and cell overview
+// function of GUI are friends of Cell, so harness (not linked to GUI) defines that function
+// to copy them
+namespace cellarium {
+void processCellOverview(Cell &cell, bool selectedCellExists);
+}
+
+// Cell properties copied by cell overview function
+static DiffCell sOverviewedDiffCell{};
+
+void cellarium::processCellOverview(Cell &cell, bool selectedCellExists) {
+  sOverviewedDiffCell = DiffCell{};
+  if (!selectedCellExists) {
+    return;
+  }
+
+  sOverviewedDiffCell.genome = cell._genome;
+#define DIFF_COPY_CELL_FIELD(Type, field, getter) sOverviewedDiffCell.field = cell._##field;
+  DIFF_CELL_FIELDS(DIFF_COPY_CELL_FIELD)
+#undef DIFF_COPY_CELL_FIELD
+}
+#endif
+
+namespace {
+
+// Returns properties of cell selected in CellController
+DiffCell getSelectedDiffCell(const cellarium::CellController &cellController) {
+#ifdef CELLARIUM_DIFF_REFERENCE
+  cellarium::Cell cell{*cellController.getSelectedCell()};
+  cellarium::processCellOverview(cell, true);
+
+  return sOverviewedDiffCell;
+#else
+  cellarium::Cell cell{};
+  cellController.getSelectedCell(cell);
+
+  DiffCell diffCell{};
+  diffCell.genome = cell.getGenome();
+#define DIFF_COPY_CELL_FIELD(Type, field, getter) diffCell.field = cell.getter();
+  DIFF_CELL_FIELDS(DIFF_COPY_CELL_FIELD)
+#undef DIFF_COPY_CELL_FIELD
+
+  return diffCell;
+#endif
+}
+
+// Returns CellController parameters made of engine parameters
+cellarium::CellController::Params makeCellControllerParams(const DiffParams &diffParams) {
+  cellarium::CellController::Params params{};
+
+#define DIFF_COPY_FIELD(Type, field) params.field = diffParams.field;
+  DIFF_PARAMS_FIELDS(DIFF_COPY_FIELD)
+#undef DIFF_COPY_FIELD
+  params.mersenneTwisterEngine = std::mt19937{diffParams.randomSeed};
+
+#ifndef CELLARIUM_DIFF_REFERENCE
+  params.threadCount       = diffParams.threadCount;
+  params.genomeInterpreter =
+      static_cast<cellarium::GenomeInterpreters>(diffParams.genomeInterpreter);
+#endif
+
+  return params;
+}
+
+// Simulation engine implementation class based on CellController
+class CellControllerDiffEngine : public DiffEngine {
+ public:
+  explicit CellControllerDiffEngine(const DiffParams &params)
+      : _cellController{makeCellControllerParams(params)} {}
+
+  void act() override { _cellController.act(); }
+
+  std::size_t getCellCount() const noexcept override { return _cellController.getCellCount(); }
+
+  DiffStatistics getSimulationStatistics() const noexcept override {
+    const cellarium::CellController::Statistics statistics{
+        _cellController.getSimulationStatistics()};
+
+    DiffStatistics diffStatistics{};
+#define DIFF_COPY_FIELD(Type, field) diffStatistics.field = statistics.field;
+    DIFF_STATISTICS_FIELDS(DIFF_COPY_FIELD)
+#undef DIFF_COPY_FIELD
+
+    return diffStatistics;
+  }
+
+  int getCellRenderingModeCount() const noexcept override {
+    return static_cast<int>(cellarium::CellRenderingModes::Size);
+  }
+
+  std::size_t getCellRenderingDataSize() const noexcept override {
+    return sizeof(cellarium::CellController::CellRenderingData);
+  }
+
+  void getCells(std::vector<DiffCell> &cells) override {
+    // Selecting cell in each slot and copying its properties if there is one
+    const int columns = _cellController.getColumns();
+    const int rows    = _cellController.getRows();
+    cells.clear();
+    for (int index = 0; index < columns * rows; ++index) {
+      if (_cellController.selectCell(index % columns, index / columns)) {
+        cells.push_back(getSelectedDiffCell(_cellController));
+      }
+    }
+
+    // Clearing selection as selected cell is rendered in other color
+    _cellController.selectCell(-1, -1);
+  }
+
+  void render(std::vector<std::uint8_t> &cellRenderingData, int cellRenderingMode) override {
+    // Rendering cells and ordering them by index
+    _cellRenderingData.assign(_cellController.getCellCount(), {});
+    _cellController.render(_cellRenderingData.data(), cellRenderingMode);
+    std::sort(_cellRenderingData.begin(), _cellRenderingData.end(),
+              [](const cellarium::CellController::CellRenderingData &data1,
+                 const cellarium::CellController::CellRenderingData &data2) {
+                return data1.index < data2.index;
+              });
+
+    // Copying rendering data to raw buffer (struct has no padding as its fields are 4 bytes long)
+    cellRenderingData.resize(_cellRenderingData.size() *
+                             sizeof(cellarium::CellController::CellRenderingData));
+    std::memcpy(cellRenderingData.data(), _cellRenderingData.data(), cellRenderingData.size());
+  }
+
+ private:
+  cellarium::CellController                                 _cellController;
+  std::vector<cellarium::CellController::CellRenderingData> _cellRenderingData{};
+};
+
+}
+
+std::unique_ptr<DiffEngine> CELLARIUM_DIFF_ENGINE_FACTORY(const DiffParams &params) {
+  return std::make_unique<CellControllerDiffEngine>(params);
+}
@@ -0,0 +1,163 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Simulation engine compared by differential test harness
+//
+// diff_engine.cpp is compiled twice: against frozen reference sources (with cellarium namespace
+// and global classes renamed by compile definitions) and against current sources, so interface
+// uses only types of its own and the API which the pre-series engine already had
+// (construction from parameters, act(), render(), statistics and cell selection).
+
+#ifndef DIFF_ENGINE_HPP
+#define DIFF_ENGINE_HPP
+
+// STD
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Fields of CellController::Params which every engine revision has
+// (pseudo-random numbers generator is seeded with random seed by engine)
+#define DIFF_PARAMS_FIELDS(FIELD)                                    \
+  FIELD(unsigned int, randomSeed)                                    \
+  FIELD(int, width)                                                  \
+  FIELD(int, height)                                                 \
+  FIELD(float, cellSize)                                             \
+  FIELD(float, maxPhotosynthesisDepthMultiplier)                     \
+  FIELD(float, maxMineralHeightMultiplier)                           \
+  FIELD(int, genomeSize)                                             \
+  FIELD(int, maxInstructionsPerTick)                                 \
+  FIELD(int, maxAkinGenomDifference)                                 \
+  FIELD(int, minChildEnergy)                                         \
+  FIELD(int, maxEnergy)                                              \
+  FIELD(int, maxBurstOfPhotosynthesisEnergy)                         \
+  FIELD(float, summerDaytimeToWholeDayRatio)                         \
+  FIELD(int, maxMinerals)                                            \
+  FIELD(int, maxBurstOfMinerals)                                     \
+  FIELD(float, energyPerMineral)                                     \
+  FIELD(int, maxBurstOfFoodEnergy)                                   \
+  FIELD(float, childBudMutationChance)                               \
+  FIELD(float, parentBudMutationChance)                              \
+  FIELD(float, randomMutationChance)                                 \
+  FIELD(int, dayDurationInTicks)                                     \
+  FIELD(int, seasonDurationInDays)                                   \
+  FIELD(int, gammaFlashPeriodInDays)                                 \
+  FIELD(int, gammaFlashMaxMutationsCount)                            \
+  FIELD(bool, enableInstructionTurn)                                 \
+  FIELD(bool, enableInstructionMove)                                 \
+  FIELD(bool, enableInstructionGetEnergyFromPhotosynthesis)          \
+  FIELD(bool, enableInstructionGetEnergyFromMinerals)                \
+  FIELD(bool, enableInstructionGetEnergyFromFood)                    \
+  FIELD(bool, enableInstructionBud)                                  \
+  FIELD(bool, enableInstructionMutateRandomGene)                     \
+  FIELD(bool, enableInstructionShareEnergy)                          \
+  FIELD(bool, enableInstructionTouch)                                \
+  FIELD(bool, enableInstructionDetermineEnergyLevel)                 \
+  FIELD(bool, enableInstructionDetermineDepth)                       \
+  FIELD(bool, enableInstructionDetermineBurstOfPhotosynthesisEnergy) \
+  FIELD(bool, enableInstructionDetermineBurstOfMinerals)             \
+  FIELD(bool, enableInstructionDetermineBurstOfMineralEnergy)        \
+  FIELD(bool, enableZeroEnergyOrganic)                               \
+  FIELD(bool, enableForcedBuddingOnMaximalEnergyLevel)               \
+  FIELD(bool, enableTryingToBudInUnoccupiedDirection)                \
+  FIELD(bool, enableDeathOnBuddingIfNotEnoughSpace)                  \
+  FIELD(bool, enableSeasons)                                         \
+  FIELD(bool, enableDaytimes)                                        \
+  FIELD(bool, enableMaximizingFoodEnergy)                            \
+  FIELD(bool, enableDeadCellPinningOnSinking)                        \
+  FIELD(std::vector<int>, firstCellGenome)                           \
+  FIELD(float, firstCellEnergyMultiplier)                            \
+  FIELD(int, firstCellDirection)                                     \
+  FIELD(float, firstCellIndexMultiplier)
+
+// Fields of CellController::Statistics which every engine revision has
+#define DIFF_STATISTICS_FIELDS(FIELD)            \
+  FIELD(int, tick)                               \
+  FIELD(int, day)                                \
+  FIELD(int, year)                               \
+  FIELD(int, season)                             \
+  FIELD(int, daysToGammaFlash)                   \
+  FIELD(int, countOfLiveCells)                   \
+  FIELD(int, countOfDeadCells)                   \
+  FIELD(long, countOfBuds)                       \
+  FIELD(long, countOfPhotosynthesisEnergyBursts) \
+  FIELD(long, countOfMineralEnergyBursts)        \
+  FIELD(long, countOfFoodEnergyBursts)
+
+// Fields of Cell which every engine revision has with names of their getters in current one
+// (genome is compared separately)
+#define DIFF_CELL_FIELDS(FIELD)                         \
+  FIELD(int, counter, getCounter)                       \
+  FIELD(int, energy, getEnergy)                         \
+  FIELD(int, minerals, getMinerals)                     \
+  FIELD(int, direction, getDirection)                   \
+  FIELD(int, index, getIndex)                           \
+  FIELD(int, age, getAge)                               \
+  FIELD(int, colorR, getColorR)                         \
+  FIELD(int, colorG, getColorG)                         \
+  FIELD(int, colorB, getColorB)                         \
+  FIELD(int, energyShareBalance, getEnergyShareBalance) \
+  FIELD(float, lastEnergyShare, getLastEnergyShare)     \
+  FIELD(bool, isAlive, isAlive)                         \
+  FIELD(bool, isPinned, isPinned)
+
+#define DIFF_DECLARE_FIELD(Type, field) Type field{};
+#define DIFF_DECLARE_CELL_FIELD(Type, field, getter) Type field{};
+
+// Simulation parameters of engine
+struct DiffParams {
+  DIFF_PARAMS_FIELDS(DIFF_DECLARE_FIELD)
+
+  // Parameters of current engine only (reference one computes cells as it always did)
+  int threadCount{};
+  int genomeInterpreter{};
+};
+
+// Simulation statistics of engine
+struct DiffStatistics {
+  DIFF_STATISTICS_FIELDS(DIFF_DECLARE_FIELD)
+};
+
+// Cell properties of engine
+struct DiffCell {
+  std::vector<int> genome{};
+  DIFF_CELL_FIELDS(DIFF_DECLARE_CELL_FIELD)
+};
+
+#undef DIFF_DECLARE_FIELD
+#undef DIFF_DECLARE_CELL_FIELD
+
+// Simulation engine interface
+class DiffEngine {
+ public:
+  virtual ~DiffEngine() noexcept = default;
+
+  // Computes next simulation tick
+  virtual void act() = 0;
+
+  // Return count of cells and simulation statistics
+  virtual std::size_t    getCellCount() const noexcept            = 0;
+  virtual DiffStatistics getSimulationStatistics() const noexcept = 0;
+
+  // Returns count of cell rendering modes and size of rendering data of one cell
+  virtual int         getCellRenderingModeCount() const noexcept = 0;
+  virtual std::size_t getCellRenderingDataSize() const noexcept  = 0;
+
+  // Fills properties of cells of all the occupied slots ordered by cell index
+  // (cells are selected one by one and selection is cleared then)
+  virtual void getCells(std::vector<DiffCell> &cells) = 0;
+
+  // Fills rendering data of all the cells in given mode ordered by cell index
+  // (engines put cells in computing order or in index order)
+  virtual void render(std::vector<std::uint8_t> &cellRenderingData, int cellRenderingMode) = 0;
+};
+
+// Create engines built from reference sources and from current (candidate) sources
+std::unique_ptr<DiffEngine> createReferenceDiffEngine(const DiffParams &params);
+std::unique_ptr<DiffEngine> createCandidateDiffEngine(const DiffParams &params);
+
+#endif
@@ -0,0 +1,282 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Differential test harness running frozen reference engine and current (candidate) engine
+// side by side and comparing statistics, every cell field by field and rendering data
+// of every mode after every tick
+
+// STD
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Qt
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonObject>
+#include <QString>
+#include <QStringList>
+
+// "cellarium" configuration loading
+#include <cellarium/configuration.hpp>
+
+// CellController
+#include <cellarium/cell_controller.hpp>
+
+// Engines built from reference and current sources
+#include "./diff_engine.hpp"
+
+// Harness parameters
+static constexpr std::array<unsigned int, 3> kRandomSeeds{0, 1, 2};
+static constexpr int                         kInitTickCount       = 500;
+static constexpr int                         kParallelThreadCount = 4;
+
+// Simulation variant run with each preset and random seed
+// (parallel tick differs from sequential one reference engine computes, so it is compared
+// with candidate engine computing the same tiles by one thread)
+struct DiffVariant {
+  const char                   *name;
+  int                           threadCount;
+  cellarium::GenomeInterpreters genomeInterpreter;
+  bool                          isComparedWithOneThread;
+};
+static constexpr std::array<DiffVariant, 3> kDiffVariants{{
+    {"sequential-switch", 0, cellarium::GenomeInterpreters::Switch, false},
+    {"sequential-threaded", 0, cellarium::GenomeInterpreters::Threaded, false},
+    {"parallel-threaded", kParallelThreadCount, cellarium::GenomeInterpreters::Threaded, true},
+}};
+
+// Returns description of the first differing field of two statistics records
+static std::string describeStatisticsDifference(const DiffStatistics &referenceStatistics,
+                                                const DiffStatistics &candidateStatistics) {
+#define DIFF_DESCRIBE_FIELD(Type, field)                                    \
+  if (referenceStatistics.field != candidateStatistics.field) {             \
+    return std::string{"statistics field "} + #field + ": " +               \
+           std::to_string(referenceStatistics.field) + " (reference) vs " + \
+           std::to_string(candidateStatistics.field) + " (candidate)";      \
+  }
+  DIFF_STATISTICS_FIELDS(DIFF_DESCRIBE_FIELD)
+#undef DIFF_DESCRIBE_FIELD
+
+  return "";
+}
+
+// Returns description of value of reference engine and value of candidate engine
+template <typename T>
+static std::string describeValues(const T &referenceValue, const T &candidateValue) {
+  std::ostringstream stream{};
+  stream << std::setprecision(std::numeric_limits<float>::max_digits10) << referenceValue
+         << " (reference) vs " << candidateValue << " (candidate)";
+  return stream.str();
+}
+
+// Returns description of the first differing field of cells of two engines and its slot
+static std::string describeCellDifference(const std::vector<DiffCell> &referenceCells,
+                                          const std::vector<DiffCell> &candidateCells) {
+  for (std::size_t i = 0; i < referenceCells.size() && i < candidateCells.size(); ++i) {
+    const DiffCell &referenceCell = referenceCells[i];
+    const DiffCell &candidateCell = candidateCells[i];
+
+    // Comparing slots first as the other fields of cells of different slots are not comparable
+    if (referenceCell.index != candidateCell.index) {
+      return "occupied slot #" + std::to_string(i) + ": " +
+             describeValues(referenceCell.index, candidateCell.index);
+    }
+
+    const std::string slot{"slot " + std::to_string(candidateCell.index)};
+#define DIFF_DESCRIBE_CELL_FIELD(Type, field, getter)                \
+  if (referenceCell.field != candidateCell.field) {                  \
+    return slot + " cell field " + #field + ": " +                   \
+           describeValues(referenceCell.field, candidateCell.field); \
+  }
+    DIFF_CELL_FIELDS(DIFF_DESCRIBE_CELL_FIELD)
+#undef DIFF_DESCRIBE_CELL_FIELD
+
+    if (referenceCell.genome.size() != candidateCell.genome.size()) {
+      return slot + " cell genome size: " +
+             describeValues(referenceCell.genome.size(), candidateCell.genome.size());
+    }
+    for (std::size_t gene = 0; gene < candidateCell.genome.size(); ++gene) {
+      if (referenceCell.genome[gene] != candidateCell.genome[gene]) {
+        return slot + " cell field genome[" + std::to_string(gene) +
+               "]: " + describeValues(referenceCell.genome[gene], candidateCell.genome[gene]);
+      }
+    }
+  }
+
+  if (referenceCells.size() != candidateCells.size()) {
+    return "count of occupied slots: " +
+           describeValues(referenceCells.size(), candidateCells.size());
+  }
+
+  return "";
+}
+
+// Returns description of the first difference of two rendering data buffers
+static std::string describeRenderingDifference(const std::vector<std::uint8_t> &referenceData,
+                                               const std::vector<std::uint8_t> &candidateData,
+                                               std::size_t cellRenderingDataSize) {
+  if (referenceData.size() != candidateData.size()) {
+    return "count of rendered cells differs";
+  }
+
+  for (std::size_t offset = 0; offset < candidateData.size(); offset += cellRenderingDataSize) {
+    if (std::memcmp(referenceData.data() + offset, candidateData.data() + offset,
+                    cellRenderingDataSize) == 0) {
+      continue;
+    }
+
+    cellarium::CellController::CellRenderingData referenceCell{}, candidateCell{};
+    std::memcpy(&referenceCell, referenceData.data() + offset, sizeof(referenceCell));
+    std::memcpy(&candidateCell, candidateData.data() + offset, sizeof(candidateCell));
+
+    std::ostringstream stream{};
+    stream << "rendered cell #" << offset / cellRenderingDataSize << ": slot "
+           << referenceCell.index << " color (" << referenceCell.colorR << ", "
+           << referenceCell.colorG << ", " << referenceCell.colorB << ") (reference) vs slot "
+           << candidateCell.index << " color (" << candidateCell.colorR << ", "
+           << candidateCell.colorG << ", " << candidateCell.colorB << ") (candidate)";
+    return stream.str();
+  }
+
+  return "rendering data differs in layout";
+}
+
+// Runs both engines with the same parameters and compares them after every tick
+// (returns -1 if they diverge or simulation cannot be started)
+static int runCase(const QFileInfo &presetFileInfo, unsigned int randomSeed,
+                   const DiffVariant &variant, int tickCount) {
+  const std::string caseName{presetFileInfo.baseName().toStdString() + " seed " +
+                             std::to_string(randomSeed) + " " + variant.name};
+  std::cerr << caseName << std::endl;
+
+  // Loading preset with given random seed and variant
+  QJsonObject                       configJsonObject{};
+  cellarium::CellController::Params cellControllerParams{};
+  if (readConfigurationFile(presetFileInfo.filePath(), configJsonObject) != 0 ||
+      loadCellControllerParams(configJsonObject, cellControllerParams) != 0) {
+    return -1;
+  }
+  DiffParams diffParams{};
+#define DIFF_COPY_FIELD(Type, field) diffParams.field = cellControllerParams.field;
+  DIFF_PARAMS_FIELDS(DIFF_COPY_FIELD)
+#undef DIFF_COPY_FIELD
+  diffParams.randomSeed        = randomSeed;
+  diffParams.threadCount       = variant.threadCount;
+  diffParams.genomeInterpreter = static_cast<int>(variant.genomeInterpreter);
+
+  // Creating both engines with the same parameters
+  std::unique_ptr<DiffEngine> referenceEngine{};
+  if (variant.isComparedWithOneThread) {
+    DiffParams oneThreadDiffParams{diffParams};
+    oneThreadDiffParams.threadCount = 1;
+    referenceEngine                 = createCandidateDiffEngine(oneThreadDiffParams);
+  } else {
+    referenceEngine = createReferenceDiffEngine(diffParams);
+  }
+  std::unique_ptr<DiffEngine> candidateEngine{createCandidateDiffEngine(diffParams)};
+  if (referenceEngine->getCellRenderingModeCount() !=
+          candidateEngine->getCellRenderingModeCount() ||
+      referenceEngine->getCellRenderingDataSize() != candidateEngine->getCellRenderingDataSize()) {
+    std::cout << "error: " << caseName << ": rendering data of engines differs in layout"
+              << std::endl;
+    return -1;
+  }
+
+  // Computing ticks and comparing statistics, cells field by field and rendering data
+  // in each mode after each of them
+  std::vector<DiffCell>     referenceCells{};
+  std::vector<DiffCell>     candidateCells{};
+  std::vector<std::uint8_t> referenceRenderingData{};
+  std::vector<std::uint8_t> candidateRenderingData{};
+  for (int tick = 1; tick <= tickCount; ++tick) {
+    referenceEngine->act();
+    candidateEngine->act();
+
+    const std::string statisticsDifference{describeStatisticsDifference(
+        referenceEngine->getSimulationStatistics(), candidateEngine->getSimulationStatistics())};
+    if (!statisticsDifference.empty()) {
+      std::cout << "mismatch: " << caseName << " tick " << tick << ": " << statisticsDifference
+                << std::endl;
+      return -1;
+    }
+    if (referenceEngine->getCellCount() != candidateEngine->getCellCount()) {
+      std::cout << "mismatch: " << caseName << " tick " << tick
+                << ": count of cells differs: " << referenceEngine->getCellCount()
+                << " (reference) vs " << candidateEngine->getCellCount() << " (candidate)"
+                << std::endl;
+      return -1;
+    }
+
+    referenceEngine->getCells(referenceCells);
+    candidateEngine->getCells(candidateCells);
+    const std::string cellDifference{describeCellDifference(referenceCells, candidateCells)};
+    if (!cellDifference.empty()) {
+      std::cout << "mismatch: " << caseName << " tick " << tick << ": " << cellDifference
+                << std::endl;
+      return -1;
+    }
+
+    for (int mode = 0; mode < candidateEngine->getCellRenderingModeCount(); ++mode) {
+      referenceEngine->render(referenceRenderingData, mode);
+      candidateEngine->render(candidateRenderingData, mode);
+      if (referenceRenderingData != candidateRenderingData) {
+        std::cout << "mismatch: " << caseName << " tick " << tick << " rendering mode " << mode
+                  << ": "
+                  << describeRenderingDifference(referenceRenderingData, candidateRenderingData,
+                                                 candidateEngine->getCellRenderingDataSize())
+                  << std::endl;
+        return -1;
+      }
+    }
+  }
+
+  return 0;
+}
+
+// Usage: cellarium_diff [presets directory] [count of ticks]
+int main(int argc, char *argv[]) {
+  // Getting presets directory and count of ticks
+  const QString presetsDirName{argc > 1 ? argv[1] : CELLARIUM_PRESETS_DIR};
+  const int     tickCount{argc > 2 ? std::atoi(argv[2]) : kInitTickCount};
+
+  // Getting sorted list of presets
+  const QDir          presetsDir{presetsDirName};
+  const QFileInfoList presetFileInfoList{
+      presetsDir.entryInfoList(QStringList() << "*.json", QDir::Files, QDir::Name)};
+  if (presetFileInfoList.isEmpty()) {
+    std::cout << "error: there are no presets in " << presetsDirName.toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Running each case to its end or to the first mismatch
+  int caseCount{};
+  int matchingCaseCount{};
+  for (const QFileInfo &presetFileInfo : presetFileInfoList) {
+    for (unsigned int randomSeed : kRandomSeeds) {
+      for (const DiffVariant &variant : kDiffVariants) {
+        ++caseCount;
+        if (runCase(presetFileInfo, randomSeed, variant, tickCount) == 0) {
+          ++matchingCaseCount;
+        }
+      }
+    }
+  }
+
+  std::cout << matchingCaseCount << " of " << caseCount << " cases match in " << tickCount
+            << " ticks" << std::endl;
+
+  return matchingCaseCount == caseCount ? EXIT_SUCCESS : EXIT_FAILURE;
+}
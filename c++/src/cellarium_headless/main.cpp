@@ -0,0 +1,274 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Simulation without window, OpenGL and Dear ImGui computing ticks at full speed
+
+// STD
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+// Qt
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QJsonObject>
+#include <QString>
+#include <QStringList>
+
+// "cellarium" configuration loading
+#include <cellarium/configuration.hpp>
+
+// CellController
+#include <cellarium/cell_controller.hpp>
+
+// Checkpointer
+#include <cellarium/checkpointer.hpp>
+
+// ReplayRecorder
+#include <cellarium/replay_log.hpp>
+
+// Global constants
+static constexpr std::string_view kApplicationName             = "cellarium_headless";
+static constexpr long             kInitStatisticsPeriodInTicks = 1000;
+
+// Outputs simulation statistics with ticks per second of the last period
+static void outputStatistics(long ticksPassed, double ticksPerSecond,
+                             const cellarium::CellController::Statistics &statistics) {
+  std::cout << "tick " << ticksPassed << " (year " << statistics.year << ", day " << statistics.day
+            << "): " << statistics.countOfLiveCells << " live cells, "
+            << statistics.countOfDeadCells << " dead cells, " << statistics.countOfBuds
+            << " buds, " << statistics.countOfPhotosynthesisEnergyBursts
+            << " photosynthesis, " << statistics.countOfMineralEnergyBursts << " mineral, "
+            << statistics.countOfFoodEnergyBursts << " food energy bursts, " << ticksPerSecond
+            << " ticks/s" << std::endl;
+}
+
+// Reads non-negative integer option value
+static int readOptionValue(const QCommandLineParser &commandLineParser, const QString &name,
+                           long &value) {
+  if (!commandLineParser.isSet(name)) {
+    return 0;
+  }
+
+  bool isValid{};
+  value = commandLineParser.value(name).toLong(&isValid);
+  if (!isValid || value < 0) {
+    std::cout << "error: " << name.toStdString() << " must be a non-negative integer" << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+// Replays replay log and outputs whether state hashes are the same as recorded ones
+static int replay(const std::string &filename) {
+  cellarium::CellController cellController{};
+  long                      divergedTick{};
+  long                      hashCount{};
+  if (cellarium::replayLog(filename, cellController, divergedTick, hashCount) != 0) {
+    return -1;
+  }
+
+  if (divergedTick == -1) {
+    std::cout << "Replay matches " << hashCount << " recorded state hashes." << std::endl;
+    return 0;
+  }
+
+  std::cout << "Replay diverges at state hash " << hashCount << " after tick " << divergedTick
+            << " (within the previous hash period)." << std::endl;
+  return 1;
+}
+
+// Main function
+int main(int argc, char *argv[]) {
+  // Initializing and configuring QCoreApplication
+  QCoreApplication qCoreApplication{argc, argv};
+  QCoreApplication::setApplicationName(QString{kApplicationName.data()});
+  QCoreApplication::setApplicationVersion("1.0");
+
+  // Initializing and configuring QCommandLineParser
+  QCommandLineParser commandLineParser{};
+  commandLineParser.setApplicationDescription(
+      "cellarium_headless computes cellarium simulation without rendering "
+      "and outputs its statistics.");
+  commandLineParser.addHelpOption();
+  commandLineParser.addPositionalArgument(
+      "config", QCoreApplication::translate("main", "Path to configuration file."));
+  commandLineParser.addOption(
+      {QStringList() << "t"
+                     << "ticks",
+       QCoreApplication::translate("main", "Count of ticks to compute (0 means no limit)."),
+       "count", "0"});
+  commandLineParser.addOption(
+      {QStringList() << "s"
+                     << "seconds",
+       QCoreApplication::translate("main", "Time limit in seconds (0 means no limit)."),
+       "seconds", "0"});
+  commandLineParser.addOption(
+      {QStringList() << "p"
+                     << "period",
+       QCoreApplication::translate("main",
+                                   "Count of ticks between statistics outputs (0 disables them)."),
+       "count", QString::number(kInitStatisticsPeriodInTicks)});
+  commandLineParser.addOption(
+      {QStringList() << "l"
+                     << "load",
+       QCoreApplication::translate("main",
+                                   "Snapshot to resume simulation from (config is not needed)."),
+       "snapshot"});
+  commandLineParser.addOption(
+      {QStringList() << "o"
+                     << "save",
+       QCoreApplication::translate(
+           "main", "Snapshot to save simulation to at each statistics output and at the end."),
+       "snapshot"});
+  commandLineParser.addOption(
+      {QStringList() << "d"
+                     << "deltas",
+       QCoreApplication::translate(
+           "main", "Count of delta snapshots saved between full snapshots (0 disables them)."),
+       "count", "0"});
+  commandLineParser.addOption(
+      {QStringList() << "r"
+                     << "record",
+       QCoreApplication::translate("main",
+                                   "Replay log to record parameters and state hashes to."),
+       "log"});
+  commandLineParser.addOption(
+      {QStringList() << "hash-period",
+       QCoreApplication::translate("main", "Count of ticks between recorded state hashes."),
+       "count", QString::number(cellarium::kInitReplayHashPeriodInTicks)});
+  commandLineParser.addOption(
+      {QStringList() << "replay",
+       QCoreApplication::translate(
+           "main", "Replay log to replay reporting the first tick whose state hash differs."),
+       "log"});
+
+  // Processing QCommandLineParser and getting positional arguments
+  commandLineParser.process(qCoreApplication);
+  const QStringList positionalArgumentList{commandLineParser.positionalArguments()};
+
+  // If replay requested
+  if (commandLineParser.isSet("replay")) {
+    return replay(commandLineParser.value("replay").toStdString());
+  }
+
+  // If neither config file nor snapshot specified
+  if (positionalArgumentList.size() < 1 && !commandLineParser.isSet("load")) {
+    std::cout << "No config file specified. See help with -h or --help." << std::endl;
+    return -1;
+  }
+
+  // Reading stop conditions and statistics period
+  long maxTicks{};
+  long maxSeconds{};
+  long statisticsPeriodInTicks{kInitStatisticsPeriodInTicks};
+  long maxDeltaCount{};
+  long hashPeriodInTicks{cellarium::kInitReplayHashPeriodInTicks};
+  if (readOptionValue(commandLineParser, "ticks", maxTicks) != 0 ||
+      readOptionValue(commandLineParser, "seconds", maxSeconds) != 0 ||
+      readOptionValue(commandLineParser, "period", statisticsPeriodInTicks) != 0 ||
+      readOptionValue(commandLineParser, "deltas", maxDeltaCount) != 0 ||
+      readOptionValue(commandLineParser, "hash-period", hashPeriodInTicks) != 0) {
+    return -1;
+  }
+
+  // Loading configuration file (window and rendering settings are ignored)
+  QJsonObject                       configJsonObject{};
+  cellarium::CellController::Params cellControllerParams{};
+  if (positionalArgumentList.size() > 0 &&
+      (readConfigurationFile(positionalArgumentList.at(0), configJsonObject) != 0 ||
+       loadCellControllerParams(configJsonObject, cellControllerParams) != 0)) {
+    return -1;
+  }
+
+  // Initializing checkpoints of simulation
+  const std::string       snapshotFilename{commandLineParser.value("save").toStdString()};
+  cellarium::Checkpointer checkpointer{snapshotFilename, static_cast<int>(maxDeltaCount)};
+
+  // Initializing simulation itself and resuming it from snapshot and its delta snapshots
+  // if specified (checkpoint chain is continued if simulation is saved to the same snapshot)
+  cellarium::CellController cellController{cellControllerParams};
+  if (commandLineParser.isSet("load")) {
+    const std::string       loadedSnapshotFilename{commandLineParser.value("load").toStdString()};
+    cellarium::Checkpointer loadedCheckpointer{loadedSnapshotFilename, 0};
+    if ((loadedSnapshotFilename == snapshotFilename ? checkpointer : loadedCheckpointer)
+            .read(cellController) != 0) {
+      return -1;
+    }
+  }
+
+  // Starting recording of replay log if specified
+  cellarium::ReplayRecorder replayRecorder{};
+  if (commandLineParser.isSet("record") &&
+      replayRecorder.open(commandLineParser.value("record").toStdString(), cellController,
+                          static_cast<int>(hashPeriodInTicks)) != 0) {
+    return -1;
+  }
+
+  // Initializing tick counters and time points
+  long       ticksPassed{};
+  long       periodStartTick{};
+  const auto startTime       = std::chrono::steady_clock::now();
+  auto       periodStartTime = startTime;
+  auto       currTime        = startTime;
+
+  // Simulation cycle
+  while (maxTicks == 0 || ticksPassed < maxTicks) {
+    // Computing next simulation tick
+    cellController.act();
+    ++ticksPassed;
+
+    // Recording state hash (parameters are not changed without GUI)
+    if (replayRecorder.isOpen() && replayRecorder.recordTick(cellController) != 0) {
+      return -1;
+    }
+
+    currTime = std::chrono::steady_clock::now();
+
+    // Outputting statistics at the end of each period
+    if (statisticsPeriodInTicks > 0 && ticksPassed % statisticsPeriodInTicks == 0) {
+      const double periodSeconds =
+          std::chrono::duration<double>(currTime - periodStartTime).count();
+      outputStatistics(ticksPassed,
+                       static_cast<double>(ticksPassed - periodStartTick) / periodSeconds,
+                       cellController.getSimulationStatistics());
+
+      periodStartTick = ticksPassed;
+      periodStartTime = currTime;
+
+      // Saving checkpoint so that simulation survives interruption
+      if (!snapshotFilename.empty() && checkpointer.write(cellController) != 0) {
+        return -1;
+      }
+    }
+
+    // Stopping if there are no live cells left (nothing can change but sinking organic)
+    if (cellController.getSimulationStatistics().countOfLiveCells == 0) {
+      std::cout << "All cells are dead." << std::endl;
+      break;
+    }
+
+    // Stopping if time limit is reached
+    if (maxSeconds > 0 && currTime - startTime >= std::chrono::seconds{maxSeconds}) {
+      std::cout << "Time limit is reached." << std::endl;
+      break;
+    }
+  }
+
+  // Outputting final statistics with average ticks per second
+  const double seconds = std::chrono::duration<double>(currTime - startTime).count();
+  outputStatistics(ticksPassed, static_cast<double>(ticksPassed) / seconds,
+                   cellController.getSimulationStatistics());
+
+  // Saving checkpoint to resume simulation later
+  if (!snapshotFilename.empty() && checkpointer.write(cellController) != 0) {
+    return -1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,141 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Microbenchmark of genome comparison kernels against the gene-by-gene loop
+
+// STD
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// "cellarium" genome comparison kernels
+#include <cellarium/genome_comparison.hpp>
+
+// Benchmark parameters
+static constexpr int          kGenomeSize       = 64;
+static constexpr int          kMaxDifference    = 4;
+static constexpr int          kGenomePairCount  = 4096;
+static constexpr int          kMaxMutationCount = 8;
+static constexpr int          kRepetitionCount  = 2000;
+static constexpr unsigned int kRandomSeed       = 0;
+
+// Compares genomes exactly like CellController::areAkin did before SIMD kernels
+static bool areGenomesAkinLoop(const std::uint8_t *genome1, const std::uint8_t *genome2,
+                               int genomeSize, int maxDifference) {
+  int diff{};
+
+  for (int i = 0; i < genomeSize; ++i) {
+    if (genome1[i] != genome2[i]) {
+      ++diff;
+      if (diff > maxDifference) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+// Runs comparison function over all genome pairs and prints time per comparison
+template <typename F>
+static int runBenchmark(const std::string &name, const std::vector<std::uint8_t> &genomes,
+                        const std::vector<std::uint8_t> &expectedResults, F compare) {
+  int akinCount{};
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < kRepetitionCount; ++r) {
+    for (int p = 0; p < kGenomePairCount; ++p) {
+      const std::uint8_t *genome1 = &genomes[static_cast<size_t>(p) * 2 * kGenomeSize];
+      const std::uint8_t *genome2 = genome1 + kGenomeSize;
+      akinCount += compare(genome1, genome2) ? 1 : 0;
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  // Checking results against the loop
+  for (int p = 0; p < kGenomePairCount; ++p) {
+    const std::uint8_t *genome1 = &genomes[static_cast<size_t>(p) * 2 * kGenomeSize];
+    const std::uint8_t *genome2 = genome1 + kGenomeSize;
+    if (compare(genome1, genome2) != static_cast<bool>(expectedResults[p])) {
+      std::cout << "error: " << name << " result mismatch at genome pair " << p << std::endl;
+      return -1;
+    }
+  }
+
+  const double nanoseconds = std::chrono::duration<double, std::nano>(end - start).count();
+  std::cout << name << ": "
+            << nanoseconds / static_cast<double>(kRepetitionCount * kGenomePairCount)
+            << " ns per comparison (" << akinCount / kRepetitionCount << " akin pairs)"
+            << std::endl;
+
+  return 0;
+}
+
+int main() {
+  // Generating genome pairs where the second genome is the first one with a few mutations
+  std::mt19937              mersenneTwisterEngine{kRandomSeed};
+  std::vector<std::uint8_t> genomes(static_cast<size_t>(kGenomePairCount) * 2 * kGenomeSize);
+  for (int p = 0; p < kGenomePairCount; ++p) {
+    std::uint8_t *genome1 = &genomes[static_cast<size_t>(p) * 2 * kGenomeSize];
+    std::uint8_t *genome2 = genome1 + kGenomeSize;
+    for (int i = 0; i < kGenomeSize; ++i) {
+      genome1[i] = static_cast<std::uint8_t>(mersenneTwisterEngine() % kGenomeSize);
+      genome2[i] = genome1[i];
+    }
+    const int mutationCount = static_cast<int>(mersenneTwisterEngine() % (kMaxMutationCount + 1));
+    for (int m = 0; m < mutationCount; ++m) {
+      genome2[mersenneTwisterEngine() % kGenomeSize] =
+          static_cast<std::uint8_t>(mersenneTwisterEngine() % kGenomeSize);
+    }
+  }
+
+  // Getting expected results
+  std::vector<std::uint8_t> expectedResults(kGenomePairCount);
+  for (int p = 0; p < kGenomePairCount; ++p) {
+    const std::uint8_t *genome1 = &genomes[static_cast<size_t>(p) * 2 * kGenomeSize];
+    expectedResults[p] =
+        areGenomesAkinLoop(genome1, genome1 + kGenomeSize, kGenomeSize, kMaxDifference);
+  }
+
+  // Running benchmarks
+  int result = runBenchmark("loop", genomes, expectedResults,
+                            [](const std::uint8_t *genome1, const std::uint8_t *genome2) {
+                              return areGenomesAkinLoop(genome1, genome2, kGenomeSize,
+                                                        kMaxDifference);
+                            });
+
+  const std::vector<std::pair<std::string, cellarium::GenomeComparisonKernels>> kernels{
+      {"scalar", cellarium::GenomeComparisonKernels::Scalar},
+      {  "sse2",   cellarium::GenomeComparisonKernels::SSE2},
+      {  "avx2",   cellarium::GenomeComparisonKernels::AVX2},
+  };
+  for (const auto &[name, kernel] : kernels) {
+    if (!cellarium::isGenomeComparisonKernelSupported(kernel)) {
+      std::cout << name << ": not supported" << std::endl;
+      continue;
+    }
+
+    result |= runBenchmark(name, genomes, expectedResults,
+                           [kernel = kernel](const std::uint8_t *genome1,
+                                             const std::uint8_t *genome2) {
+                             return cellarium::arePackedGenomesAkin(kernel, genome1, genome2,
+                                                                    kGenomeSize, kMaxDifference);
+                           });
+  }
+
+  result |= runBenchmark("dispatched", genomes, expectedResults,
+                         [](const std::uint8_t *genome1, const std::uint8_t *genome2) {
+                           return cellarium::arePackedGenomesAkin(genome1, genome2, kGenomeSize,
+                                                                  kMaxDifference);
+                         });
+
+  return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
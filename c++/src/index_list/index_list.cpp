@@ -0,0 +1,241 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Header file
+#include "./index_list.hpp"
+
+// STD
+#include <utility>
+
+IndexList::Iterator::Iterator(IndexList *indexList) noexcept : _indexList{indexList} {}
+
+IndexList::Iterator::Iterator(const Iterator &iterator) noexcept
+    : _indexList{iterator._indexList} {}
+
+IndexList::Iterator &IndexList::Iterator::operator=(const Iterator &iterator) noexcept {
+  _indexList = iterator._indexList;
+
+  return *this;
+}
+
+IndexList::Iterator::Iterator(Iterator &&iterator) noexcept
+    : _indexList{std::exchange(iterator._indexList, nullptr)} {}
+
+IndexList::Iterator &IndexList::Iterator::operator=(Iterator &&iterator) noexcept {
+  std::swap(_indexList, iterator._indexList);
+
+  return *this;
+}
+
+IndexList::Iterator::~Iterator() noexcept {}
+
+bool IndexList::Iterator::hasNext() const noexcept {
+  return _indexList->_iteratorNext != kEndIndex;
+}
+
+int IndexList::Iterator::next() noexcept {
+  const int index           = _indexList->_iteratorNext;
+  _indexList->_iteratorNext = _indexList->_nextIndices[index];
+  return index;
+}
+
+IndexList::ConstIterator::ConstIterator(const IndexList *indexList, int next) noexcept
+    : _indexList{indexList}, _next{next} {}
+
+IndexList::ConstIterator::ConstIterator(const ConstIterator &constIterator) noexcept
+    : _indexList{constIterator._indexList}, _next{constIterator._next} {}
+
+IndexList::ConstIterator &IndexList::ConstIterator::operator=(
+    const ConstIterator &constIterator) noexcept {
+  _indexList = constIterator._indexList;
+  _next      = constIterator._next;
+
+  return *this;
+}
+
+IndexList::ConstIterator::ConstIterator(ConstIterator &&constIterator) noexcept
+    : _indexList{std::exchange(constIterator._indexList, nullptr)},
+      _next{std::exchange(constIterator._next, kEndIndex)} {}
+
+IndexList::ConstIterator &IndexList::ConstIterator::operator=(
+    ConstIterator &&constIterator) noexcept {
+  std::swap(_indexList, constIterator._indexList);
+  std::swap(_next, constIterator._next);
+
+  return *this;
+}
+
+IndexList::ConstIterator::~ConstIterator() noexcept {}
+
+bool IndexList::ConstIterator::hasNext() const noexcept { return _next != kEndIndex; }
+
+int IndexList::ConstIterator::next() noexcept {
+  const int index = _next;
+  _next           = _indexList->_nextIndices[index];
+  return index;
+}
+
+IndexList::IndexList() noexcept {}
+
+IndexList::IndexList(int capacity)
+    : _prevIndices(capacity, kAbsentIndex), _nextIndices(capacity, kAbsentIndex) {}
+
+IndexList::IndexList(const IndexList &indexList)
+    : _prevIndices{indexList._prevIndices},
+      _nextIndices{indexList._nextIndices},
+      _first{indexList._first},
+      _elementCount{indexList._elementCount} {}
+
+IndexList &IndexList::operator=(const IndexList &indexList) {
+  _prevIndices  = indexList._prevIndices;
+  _nextIndices  = indexList._nextIndices;
+  _first        = indexList._first;
+  _elementCount = indexList._elementCount;
+  _iteratorNext = kEndIndex;
+
+  return *this;
+}
+
+IndexList::IndexList(IndexList &&indexList) noexcept
+    : _prevIndices{std::exchange(indexList._prevIndices, std::vector<int>{})},
+      _nextIndices{std::exchange(indexList._nextIndices, std::vector<int>{})},
+      _first{std::exchange(indexList._first, kEndIndex)},
+      _elementCount{std::exchange(indexList._elementCount, 0)},
+      _iteratorNext{std::exchange(indexList._iteratorNext, kEndIndex)} {}
+
+IndexList &IndexList::operator=(IndexList &&indexList) noexcept {
+  std::swap(_prevIndices, indexList._prevIndices);
+  std::swap(_nextIndices, indexList._nextIndices);
+  std::swap(_first, indexList._first);
+  std::swap(_elementCount, indexList._elementCount);
+  std::swap(_iteratorNext, indexList._iteratorNext);
+
+  return *this;
+}
+
+IndexList::~IndexList() noexcept {}
+
+int IndexList::pushFront(int index) noexcept {
+  // If index is out of range or is already in the list
+  if (index < 0 || index >= static_cast<int>(_nextIndices.size()) || contains(index)) {
+    // Index is not added
+    return -1;
+  }
+
+  // Linking index before the first one
+  _prevIndices[index] = kEndIndex;
+  _nextIndices[index] = _first;
+  if (_first != kEndIndex) {
+    _prevIndices[_first] = index;
+  }
+  _first = index;
+
+  // Index is added
+  ++_elementCount;
+  return 0;
+}
+
+int IndexList::replace(int index, int newIndex) noexcept {
+  // If index is not in the list or new index is out of range or is already in the list
+  if (!contains(index) || newIndex < 0 || newIndex >= static_cast<int>(_nextIndices.size()) ||
+      contains(newIndex)) {
+    // Index is not replaced
+    return -1;
+  }
+
+  // Moving links of index to new index
+  const int prevIndex    = _prevIndices[index];
+  const int nextIndex    = _nextIndices[index];
+  _prevIndices[newIndex] = prevIndex;
+  _nextIndices[newIndex] = nextIndex;
+  _prevIndices[index]    = kAbsentIndex;
+  _nextIndices[index]    = kAbsentIndex;
+
+  // Relinking neighbours
+  if (prevIndex != kEndIndex) {
+    _nextIndices[prevIndex] = newIndex;
+  } else {
+    _first = newIndex;
+  }
+  if (nextIndex != kEndIndex) {
+    _prevIndices[nextIndex] = newIndex;
+  }
+
+  // Making current traversal follow the replaced index
+  if (_iteratorNext == index) {
+    _iteratorNext = newIndex;
+  }
+
+  // Index is replaced
+  return 0;
+}
+
+int IndexList::remove(int index) noexcept {
+  // If index is not in the list
+  if (!contains(index)) {
+    // Index is not removed
+    return -1;
+  }
+
+  // Unlinking index
+  const int prevIndex = _prevIndices[index];
+  const int nextIndex = _nextIndices[index];
+  if (prevIndex != kEndIndex) {
+    _nextIndices[prevIndex] = nextIndex;
+  } else {
+    _first = nextIndex;
+  }
+  if (nextIndex != kEndIndex) {
+    _prevIndices[nextIndex] = prevIndex;
+  }
+  _prevIndices[index] = kAbsentIndex;
+  _nextIndices[index] = kAbsentIndex;
+
+  // Ending current traversal if its next index is removed
+  // (the linked list iterator expired the same way, so cells after the eaten one
+  // act at the next tick as they always did)
+  if (_iteratorNext == index) {
+    _iteratorNext = kEndIndex;
+  }
+
+  // Index is removed
+  --_elementCount;
+  return 0;
+}
+
+void IndexList::clear() noexcept {
+  // Unlinking all indices
+  int index = _first;
+  while (index != kEndIndex) {
+    const int nextIndex = _nextIndices[index];
+    _prevIndices[index] = kAbsentIndex;
+    _nextIndices[index] = kAbsentIndex;
+    index               = nextIndex;
+  }
+
+  // Resetting the list and current traversal
+  _first        = kEndIndex;
+  _elementCount = 0;
+  _iteratorNext = kEndIndex;
+}
+
+bool IndexList::contains(int index) const noexcept {
+  return index >= 0 && index < static_cast<int>(_nextIndices.size()) &&
+         _nextIndices[index] != kAbsentIndex;
+}
+
+size_t IndexList::count() const noexcept { return _elementCount; }
+
+IndexList::Iterator IndexList::getIterator() noexcept {
+  // Starting new changing traversal
+  _iteratorNext = _first;
+
+  return Iterator{this};
+}
+
+IndexList::ConstIterator IndexList::getIterator() const noexcept {
+  return ConstIterator{this, _first};
+}
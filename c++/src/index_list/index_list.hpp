@@ -0,0 +1,94 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef INDEX_LIST_HPP
+#define INDEX_LIST_HPP
+
+// STD
+#include <cstddef>
+#include <vector>
+
+// Doubly linked list of unique indices in range from 0 to capacity
+// with links stored in arrays indexed by the indices themselves (all operations are O(1))
+class IndexList {
+ public:
+  // Index that marks the end of the list
+  static constexpr int kEndIndex = -1;
+
+ private:
+  // Index that marks absence of the element in the list
+  static constexpr int kAbsentIndex = -2;
+
+  std::vector<int> _prevIndices{};
+  std::vector<int> _nextIndices{};
+
+  int _first{kEndIndex};
+
+  int _elementCount{};
+
+  // Next index of the current changing traversal (updated on remove and replace)
+  int _iteratorNext{kEndIndex};
+
+ public:
+  // Index list iterator implementation class for traversal changing the list
+  // (only one traversal at a time, it stays valid after remove and replace of any element
+  // and ends if its next element is removed)
+  class Iterator {
+   private:
+    IndexList *_indexList{};
+
+   public:
+    explicit Iterator(IndexList *indexList) noexcept;
+    Iterator(const Iterator &iterator) noexcept;
+    Iterator &operator=(const Iterator &iterator) noexcept;
+    Iterator(Iterator &&iterator) noexcept;
+    Iterator &operator=(Iterator &&iterator) noexcept;
+    ~Iterator() noexcept;
+
+    bool hasNext() const noexcept;
+    int  next() noexcept;
+  };
+
+  // Index list iterator implementation class for traversal not changing the list
+  // (any count of traversals at a time, they do not touch the changing traversal)
+  class ConstIterator {
+   private:
+    const IndexList *_indexList{};
+    int              _next{kEndIndex};
+
+   public:
+    ConstIterator(const IndexList *indexList, int next) noexcept;
+    ConstIterator(const ConstIterator &constIterator) noexcept;
+    ConstIterator &operator=(const ConstIterator &constIterator) noexcept;
+    ConstIterator(ConstIterator &&constIterator) noexcept;
+    ConstIterator &operator=(ConstIterator &&constIterator) noexcept;
+    ~ConstIterator() noexcept;
+
+    bool hasNext() const noexcept;
+    int  next() noexcept;
+  };
+
+  IndexList() noexcept;
+  explicit IndexList(int capacity);
+  IndexList(const IndexList &indexList);
+  IndexList &operator=(const IndexList &indexList);
+  IndexList(IndexList &&indexList) noexcept;
+  IndexList &operator=(IndexList &&indexList) noexcept;
+  ~IndexList() noexcept;
+
+  int  pushFront(int index) noexcept;
+  int  replace(int index, int newIndex) noexcept;
+  int  remove(int index) noexcept;
+  void clear() noexcept;
+
+  bool   contains(int index) const noexcept;
+  size_t count() const noexcept;
+
+  Iterator      getIterator() noexcept;
+  ConstIterator getIterator() const noexcept;
+};
+
+#endif
@@ -0,0 +1,93 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+// Header file
+#include "./thread_pool.hpp"
+
+ThreadPool::ThreadPool(int threadCount) {
+  // Starting workers
+  for (int i = 1; i < threadCount; ++i) {
+    _workers.emplace_back(&ThreadPool::work, this);
+  }
+}
+
+ThreadPool::~ThreadPool() noexcept {
+  // Waking workers up to stop
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _isStopping = true;
+  }
+  _runCondition.notify_all();
+
+  // Waiting for workers to stop
+  for (std::thread &worker : _workers) {
+    worker.join();
+  }
+}
+
+void ThreadPool::run(int taskCount, const std::function<void(int)> &task) {
+  // Running tasks in calling thread if there are no workers
+  if (_workers.empty()) {
+    for (int i = 0; i < taskCount; ++i) {
+      task(i);
+    }
+    return;
+  }
+
+  // Publishing tasks and waking workers up
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _task            = &task;
+    _taskCount       = taskCount;
+    _nextTaskIndex   = 0;
+    _busyWorkerCount = static_cast<int>(_workers.size());
+    ++_runNumber;
+  }
+  _runCondition.notify_all();
+
+  // Taking part in the run
+  runTasks();
+
+  // Waiting for workers to finish their last tasks
+  std::unique_lock<std::mutex> lock{_mutex};
+  _doneCondition.wait(lock, [this]() { return _busyWorkerCount == 0; });
+  _task = nullptr;
+}
+
+int ThreadPool::getThreadCount() const noexcept { return static_cast<int>(_workers.size()) + 1; }
+
+void ThreadPool::work() {
+  long runNumber{};
+
+  while (true) {
+    // Waiting for the next run or stop
+    {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _runCondition.wait(lock, [this, runNumber]() {
+        return _isStopping || _runNumber != runNumber;
+      });
+      if (_isStopping) {
+        return;
+      }
+      runNumber = _runNumber;
+    }
+
+    // Taking part in the run
+    runTasks();
+
+    // Notifying calling thread if it is the last busy worker
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (--_busyWorkerCount == 0) {
+      _doneCondition.notify_one();
+    }
+  }
+}
+
+void ThreadPool::runTasks() {
+  for (int i = _nextTaskIndex++; i < _taskCount; i = _nextTaskIndex++) {
+    (*_task)(i);
+  }
+}
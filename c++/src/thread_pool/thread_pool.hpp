@@ -0,0 +1,60 @@
+// Copyright 2021 Malovanyi Denys Olehovych (maldenol)
+//
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+// STD
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Pool of worker threads running tasks indexed from 0 to task count together with calling thread
+class ThreadPool {
+ private:
+  std::vector<std::thread> _workers{};
+
+  std::mutex              _mutex{};
+  std::condition_variable _runCondition{};
+  std::condition_variable _doneCondition{};
+
+  // Current run tasks (tasks are claimed by incrementing next task index)
+  const std::function<void(int)> *_task{};
+  int                             _taskCount{};
+  std::atomic<int>                _nextTaskIndex{};
+
+  // Count of workers that have not finished current run yet
+  int _busyWorkerCount{};
+  // Run number that wakes workers up when incremented
+  long _runNumber{};
+
+  bool _isStopping{};
+
+ public:
+  // Creates threadCount - 1 workers (calling thread is the last one)
+  explicit ThreadPool(int threadCount);
+  ThreadPool(const ThreadPool &threadPool) = delete;
+  ThreadPool &operator=(const ThreadPool &threadPool) = delete;
+  ThreadPool(ThreadPool &&threadPool)                 = delete;
+  ThreadPool &operator=(ThreadPool &&threadPool) = delete;
+  ~ThreadPool() noexcept;
+
+  // Calls task for each index in range from 0 to taskCount and returns when all calls are done
+  void run(int taskCount, const std::function<void(int)> &task);
+
+  int getThreadCount() const noexcept;
+
+ private:
+  // Waits for runs and takes part in them until the pool is stopped
+  void work();
+  // Calls task for indices claimed until there are no more ones
+  void runTasks();
+};
+
+#endif